@@ -0,0 +1,158 @@
+/**************************************************************
+* @file Decimation.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "Decimation.h"
+#include "swiftdds/rtps/CdrSize.h"
+//#include <iostream>
+
+Decimation::Decimation()
+{
+	m_id = 0;
+	m_index = 0;
+
+}
+
+DdsCdr& Decimation::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_values);
+
+	return cdr;
+}
+uint32_t Decimation::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	Decimation* pData = static_cast<Decimation*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& Decimation::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_values);
+
+	return cdr;
+}
+bool Decimation::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	Decimation* pData = static_cast<Decimation*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool Decimation::is_key_defined()
+{
+	return true;
+
+}
+void Decimation::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void Decimation::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(uint32_t);
+	}
+
+}
+bool Decimation::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool Decimation::is_plain_types()
+{
+	return true;
+}
+uint32_t Decimation::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_values);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const Decimation::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void Decimation::set_key_val(Decimation const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+void Decimation::id(uint32_t const _id)
+{
+	m_id = _id;
+}
+uint32_t Decimation::id() const
+{
+	return m_id;
+}
+uint32_t& Decimation::id()
+{
+	return m_id;
+}
+
+void Decimation::index(uint64_t const _index)
+{
+	m_index = _index;
+}
+uint64_t Decimation::index() const
+{
+	return m_index;
+}
+uint64_t& Decimation::index()
+{
+	return m_index;
+}
+
+void Decimation::values(std::array<double,6> const &_values)
+{
+	m_values = _values;
+}
+void Decimation::values(std::array<double,6> &&_values)
+{
+	m_values = std::move(_values);
+}
+std::array<double,6> const& Decimation::values() const
+{
+	return m_values;
+}
+std::array<double,6>& Decimation::values()
+{
+	return m_values;
+}
+
@@ -0,0 +1,86 @@
+/**************************************************************
+* @file Decimation.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#ifndef DECIMATION_26f46e9cb24504693527b6fc298553da_H
+#define DECIMATION_26f46e9cb24504693527b6fc298553da_H
+
+#include <stdint.h>
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+#include "swiftdds/rtps/DdsOptionalMember.h"
+
+
+
+
+/**
+* @class Decimation
+* @brief A class as the datatype for data exchange.
+* @note
+*/
+
+class Decimation
+{
+public:
+	static constexpr bool IS_KEY_DEFINED = true;
+	static constexpr uint32_t DATA_SIZE = sizeof(uint32_t) + sizeof(uint64_t) + sizeof(std::array<double,6>);
+	static constexpr bool IS_DATA_PADDING = true;
+	static constexpr bool IS_ID_DEFINED = false;
+
+	Decimation();
+	~Decimation() = default;
+	Decimation(Decimation const &x) = default;
+	Decimation(Decimation &&x) = default;
+	Decimation& operator=(Decimation const &x) = default;
+	Decimation& operator=(Decimation &&x) = default;
+
+	DdsCdr& serialize(DdsCdr &cdr) const;
+	static uint32_t serialize(void *const data, char *const payload_buf, uint32_t const payload_len);
+
+	DdsCdr& deserialize(DdsCdr &cdr);
+	static bool deserialize(char *const payload_buf, uint32_t const payload_len, void *const data);
+
+	static bool is_key_defined();
+	void serialize_key(DdsCdr &cdr) const;
+
+	void serialize_key(char **buf,unsigned int *len);
+	bool is_key_serialize_by_cdr();
+	static bool is_plain_types();
+	uint32_t max_align_size(uint32_t const _cur_al) const;
+	static greenstone::dds::SerializedPayloadHeader const get_serialized_payload_header();
+	void set_key_val(Decimation const* const _data) noexcept;
+
+
+
+	void id(uint32_t const _id);
+	uint32_t id() const;
+	uint32_t& id();
+
+	void index(uint64_t const _index);
+	uint64_t index() const;
+	uint64_t& index();
+
+	void values(std::array<double,6> const &_values);
+	void values(std::array<double,6> &&_values);
+	std::array<double,6> const& values() const;
+	std::array<double,6>& values();
+
+
+
+
+
+private:
+	uint32_t m_id;
+	uint64_t m_index;
+	std::array<double,6> m_values;
+
+};
+
+
+#endif	// DECIMATION_26f46e9cb24504693527b6fc298553da_H
+
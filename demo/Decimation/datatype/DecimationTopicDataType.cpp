@@ -0,0 +1,170 @@
+/**************************************************************
+* @file DecimationTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "DecimationTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+DecimationTopicDataType::DecimationTopicDataType() : TopicDataType()
+{
+	set_name("DecimationTopicDataType");
+}
+DecimationTopicDataType::~DecimationTopicDataType()
+{
+
+}
+bool DecimationTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	Decimation* pData = static_cast<Decimation*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool DecimationTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	Decimation* pData = static_cast<Decimation*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool DecimationTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Decimation::is_key_defined())
+	{
+		return false;
+	}
+	Decimation* pData = static_cast<Decimation*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool DecimationTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Decimation::is_key_defined())
+	{
+		return false;
+	}
+	Decimation *data = new Decimation{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool DecimationTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)Decimation;
+
+	return true;
+}
+uint32_t DecimationTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	Decimation* pData = static_cast<Decimation*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool DecimationTopicDataType::is_with_key() noexcept
+{
+	return Decimation::is_key_defined();
+}
+bool DecimationTopicDataType::is_plain_types() noexcept
+{
+	return Decimation::is_plain_types();
+}
+void* DecimationTopicDataType::create_data_resource() noexcept
+{
+	Decimation* pData = new Decimation;
+
+	return pData;
+}
+void DecimationTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	Decimation* pData = reinterpret_cast<Decimation*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const DecimationTopicDataType::get_serialized_payload_header() noexcept
+{
+	return Decimation::get_serialized_payload_header();
+}
+
+void* const DecimationTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Decimation* pData = reinterpret_cast<Decimation*>(data);
+	Decimation* newData = new Decimation{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const DecimationTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Decimation *data = new Decimation{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void DecimationTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	Decimation* pData = reinterpret_cast<Decimation*>(data);
+	Decimation const* const keyData = reinterpret_cast<Decimation const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t DecimationTopicDataType::data_size_of() noexcept
+{
+	return sizeof(Decimation);
+}
+
@@ -0,0 +1,52 @@
+/**************************************************************
+* @file DecimationTopicDataType.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#ifndef DECIMATIONTOPICDATATYPE_26f46e9cb24504693527b6fc298553da_H
+#define DECIMATIONTOPICDATATYPE_26f46e9cb24504693527b6fc298553da_H
+
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+#include "Decimation.h"
+
+
+
+
+/**
+* @class DecimationTopicDataType
+* @brief A class used as the topic during data exchange.
+* @note
+*/
+
+class DecimationTopicDataType : public greenstone::dds::TopicDataType
+{
+public:
+	using InstanceHandle_t = greenstone::dds::InstanceHandle_t;
+
+	DecimationTopicDataType();
+	virtual ~DecimationTopicDataType();
+
+	bool serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value);
+	bool deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void* data);
+
+	// The func of getKey is non-thread-safe
+	bool get_key(void* data, InstanceHandle_t* ihandle) noexcept;
+	bool get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept;
+	bool init_data_ptr(void* data) noexcept;
+	uint32_t get_cdr_serialized_size(void *data) noexcept;
+	bool is_with_key() noexcept;
+	bool is_plain_types() noexcept;
+	void* create_data_resource() noexcept;
+	void release_data_resource(void *data) noexcept;
+	greenstone::dds::SerializedPayloadHeader const get_serialized_payload_header() noexcept;
+	void* const get_key_value_data(void * const data) noexcept;
+	void* const get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept;
+	void copy_key_value_to_data(void const *const key_data, void *const data) noexcept;
+	uint32_t data_size_of() noexcept;
+
+};
+
+#endif	// DECIMATIONTOPICDATATYPE_26f46e9cb24504693527b6fc298553da_H
+
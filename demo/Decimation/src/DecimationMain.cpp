@@ -0,0 +1,264 @@
+/**************************************************************
+* @file DecimationMain.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "DecimationWriter.h"
+#include "DecimationReader.h"
+#include "ConfigParser.h"
+
+enum ParseResult
+{
+    SUCCESS,
+    FAILURE
+};
+
+enum NodeType
+{
+    UNDEFINED,
+    PUBLISHER,
+    SUBSCRIBER
+};
+
+struct ParsedArguments
+{
+    NodeType nodeType;
+    std::string cfgPath;
+    uint32_t numOfInstances;
+    std::string topicName;
+    uint32_t rate;
+    uint32_t duration;
+    bool decimate;
+    ParseResult parseResult;
+};
+
+inline bool exists (const std::string& name)
+{
+    if (FILE* file = fopen(name.c_str(), "r"))
+    {
+        fclose(file);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+inline ParsedArguments parse_arguments(int argc, char* argv[])
+{
+    ParsedArguments parsedArguments;
+    parsedArguments.nodeType = NodeType::UNDEFINED;
+    parsedArguments.cfgPath = "config.json";
+    parsedArguments.numOfInstances = 10;
+    parsedArguments.topicName = "Decimation";
+    parsedArguments.rate = 1000;
+    parsedArguments.duration = 10;
+    parsedArguments.decimate = false;
+    parsedArguments.parseResult = ParseResult::SUCCESS;
+
+    int argCount = 1;
+    bool printHelp = false;
+
+    while (argCount < argc)
+    {
+        if (strcmp(argv[argCount], "-h") == 0 || strcmp(argv[argCount], "--help") == 0)
+        {
+            std::cout << "List of arguments.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+        else if (strcmp(argv[argCount], "-n") == 0 || strcmp(argv[argCount], "--node-type") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Node type is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else if (strcmp(argv[argCount + 1], "pub") == 0 || strcmp(argv[argCount + 1], "publisher") == 0)
+            {
+                parsedArguments.nodeType = NodeType::PUBLISHER;
+            }
+            else if (strcmp(argv[argCount + 1], "sub") == 0 || strcmp(argv[argCount + 1], "subscriber") == 0)
+            {
+                parsedArguments.nodeType = NodeType::SUBSCRIBER;
+            }
+            else
+            {
+                std::cout << "Node type needs to be assigned as a 'publisher' or 'subscriber'" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-c") == 0 || strcmp(argv[argCount], "--config-path") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Configuration file is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.cfgPath = argv[argCount + 1];
+                if (!exists(parsedArguments.cfgPath))
+                {
+                    std::cout << "Configuration file does not exist or the path is wrong" << std::endl;
+                    parsedArguments.parseResult = ParseResult::FAILURE;
+                    break;
+                }
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-k") == 0 || strcmp(argv[argCount], "--number-of-keys") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of instances is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.numOfInstances = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-t") == 0 || strcmp(argv[argCount], "--topic-name") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Topic name is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.topicName = argv[argCount + 1];
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-f") == 0 || strcmp(argv[argCount], "--frequency") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Publishing frequency is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.rate = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-d") == 0 || strcmp(argv[argCount], "--duration") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Duration is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.duration = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-w") == 0 || strcmp(argv[argCount], "--writer-decimation") == 0)
+        {
+            parsedArguments.decimate = true;
+            argCount += 1;
+        }
+        else
+        {
+            std::cout << "Wrong arguments. Please check optional arguments as below.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+    }
+
+    if (printHelp)
+    {
+        std::cout << "Usage:\n"\
+                    "    -n, --node-type        <string>      Type of application node\n"
+                    "                                         Values: publisher, pub, subscriber, sub\n"\
+                    "                                         Default: undefined\n"\
+                    "    -c, --config-path      <string>      Path of configuration file\n"\
+                    "                                         Default: ./config.json\n"
+                    "    -t, --topic-name       <string>      Topic name that is used to match writer and reader\n"\
+                    "                                         Default: Decimation\n"
+                    "    -k, --number-of-keys   <int>         Number of keys (instances) to be published\n"\
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 10\n"
+                    "    -f, --frequency        <int>         Publishing frequency of each instance (Hz)\n"\
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 1000\n"
+                    "    -d, --duration         <int>         Duration of publishing (second)\n"
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 10\n"
+                    "    -w, --writer-decimation              Skip the samples that all matched readers would drop\n"
+                    "                                         by their time_based_filter\n"
+                    "                                         ONLY effective on Writer\n"
+        << std::endl;
+    }
+
+    return parsedArguments;
+}
+
+
+int main(int argc, char *argv[])
+{
+    ParsedArguments arguments = parse_arguments(argc, argv);
+
+    if (arguments.parseResult == ParseResult::FAILURE)
+    {
+        return 0;
+    }
+
+    ConfigParser::get_instance()->load_config_file(arguments.cfgPath);
+
+    try
+    {
+        switch (arguments.nodeType)
+        {
+            case NodeType::PUBLISHER:
+            {
+                // Create an instance of DataWriter to publish at a fixed rate
+                DecimationWriter dataWriter;
+                if (dataWriter.init(arguments.topicName, arguments.decimate))
+                {
+                    dataWriter.run(arguments.numOfInstances, arguments.rate, arguments.duration);
+                }
+                break;
+            }
+            case NodeType::SUBSCRIBER:
+            {
+                // Create an instance of DataReader to count delivered samples
+                DecimationReader dataReader;
+                if (dataReader.init(arguments.topicName))
+                {
+                    dataReader.run();
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Exception in run(): " << ex.what() << std::endl;
+        return 0;
+    }
+    return 0;
+}
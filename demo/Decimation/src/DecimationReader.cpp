@@ -0,0 +1,125 @@
+/**************************************************************
+* @file DecimationReader.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <sys/resource.h>
+
+#include "DecimationReader.h"
+#include "ConfigParser.h"
+
+void DecimationReader::MyDataReaderListener::on_data_available(greenstone::dds::DataReader* reader) noexcept
+{
+    while (reader->take_next_sample(&m_decimation, m_info) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        if (m_info.valid_data)
+        {
+            ++m_delivered;
+        }
+    }
+}
+
+DecimationReader::DecimationReader()
+    : m_participant(nullptr),
+      m_topic(nullptr),
+      m_subscriber(nullptr),
+      m_reader(nullptr),
+      m_readerListener(new MyDataReaderListener())
+{
+}
+
+DecimationReader::~DecimationReader()
+{
+    delete m_readerListener;
+}
+
+bool DecimationReader::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_sub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_decimationTopicType);
+    std::string topicTypeName = m_decimationTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create subscriber
+    m_subscriber = ConfigParser::get_instance()->get_subscriber_from_json(
+        "subscriber_cfg", m_participant, nullptr, m_mask);
+    if (m_subscriber == nullptr)
+    {
+        return false;
+    }
+
+    // Create datareader
+    m_reader = ConfigParser::get_instance()->get_reader_from_json(
+        "reader_cfg", m_subscriber, m_topic, m_readerListener, m_mask);
+    if (m_reader == nullptr)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void DecimationReader::destroy()
+{
+    if (m_subscriber->delete_datareader(m_reader) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete reader error" << std::endl;
+    }
+    if (m_participant->delete_subscriber(m_subscriber) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete subscriber error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+int64_t DecimationReader::get_process_cpu_time()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (static_cast<int64_t>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000
+        + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+void DecimationReader::run()
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_readerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    std::cout << "Listeners have been matched successfully.\n\nCounting samples until the writer leaves..." << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t cpuStart = get_process_cpu_time();
+    while (m_readerListener->get_number_of_matched() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    int64_t cpuUsed = get_process_cpu_time() - cpuStart;
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "\n[reader] delivered: " << m_readerListener->get_number_of_delivered()
+              << "; elapsed: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms"
+              << "; CPU: " << cpuUsed << " us\n" << std::endl;
+
+    destroy();
+}
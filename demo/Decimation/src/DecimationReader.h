@@ -0,0 +1,75 @@
+/**************************************************************
+* @file DecimationReader.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef DECIMATION_READER_H
+#define DECIMATION_READER_H
+
+#include "GeneralListeners.h"
+#include "DecimationTopicDataType.h"
+
+/**
+* @class DecimationReader
+* @brief A wrapper class subscribing Decimation topic with the time_based_filter of the configuration
+*        and counting the samples delivered to the application.
+* @note
+*/
+
+class DecimationReader
+{
+public:
+
+    DecimationReader();
+
+    ~DecimationReader();
+
+    // Initialize DDS entities for subscribing Decimation topic
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Count delivered samples until the writer leaves
+    void run();
+
+private:
+
+    // Get the CPU time consumed by this process (microsecond)
+    int64_t get_process_cpu_time();
+
+    // Instance of DecimationTopicDataType
+    DecimationTopicDataType m_decimationTopicType;
+
+    // DDS entities for DataReader
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Subscriber* m_subscriber;
+    greenstone::dds::DataReader* m_reader;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // A child class of GeneralReaderListener counting delivered samples
+    class MyDataReaderListener : public GeneralReaderListener
+    {
+    public:
+        MyDataReaderListener() {}
+        ~MyDataReaderListener() {}
+
+        // Callback function on_data_available
+        void on_data_available(greenstone::dds::DataReader* reader) noexcept override;
+
+        // Get number of samples delivered
+        uint64_t get_number_of_delivered() const
+        {
+            return m_delivered;
+        }
+
+    private:
+        Decimation m_decimation;
+        greenstone::dds::SampleInfo m_info;
+        std::atomic<uint64_t> m_delivered {0};
+    }* m_readerListener;
+};
+
+#endif  // DECIMATION_READER_H
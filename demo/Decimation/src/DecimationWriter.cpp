@@ -0,0 +1,184 @@
+/**************************************************************
+* @file DecimationWriter.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <sys/resource.h>
+
+#include "DecimationWriter.h"
+#include "ConfigParser.h"
+
+void DecimationWriter::MyDataWriterListener::on_publication_matched(
+    greenstone::dds::DataWriter* writer,
+    greenstone::dds::PublicationMatchedStatus const& status) noexcept
+{
+    // Refresh the decimator first, so it is up to date once the matched count changes
+    if (m_decimator != nullptr)
+    {
+        m_decimator->update_matched_readers(writer);
+    }
+    GeneralWriterListener::on_publication_matched(writer, status);
+}
+
+DecimationWriter::DecimationWriter()
+    : m_participant(nullptr),
+      m_topic(nullptr),
+      m_publisher(nullptr),
+      m_writer(nullptr),
+      m_decimate(false),
+      m_writerListener(nullptr)
+{
+}
+
+DecimationWriter::~DecimationWriter()
+{
+    delete m_writerListener;
+}
+
+bool DecimationWriter::init(const std::string& topicName, const bool& decimate)
+{
+    m_decimate = decimate;
+    m_writerListener = new MyDataWriterListener(decimate ? &m_decimator : nullptr);
+
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_pub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_decimationTopicType);
+    std::string topicTypeName = m_decimationTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create publisher
+    m_publisher = ConfigParser::get_instance()->get_publisher_from_json(
+        "publisher_cfg", m_participant, nullptr, m_mask);
+    if (m_publisher == nullptr)
+    {
+        return false;
+    }
+
+    // Create datawriter
+    m_writer = ConfigParser::get_instance()->get_writer_from_json(
+        "writer_cfg", m_publisher, m_topic, m_writerListener, m_mask);
+    if (m_writer == nullptr)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void DecimationWriter::destroy()
+{
+    if (m_publisher->delete_datawriter(m_writer) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete writer error" << std::endl;
+    }
+    if (m_participant->delete_publisher(m_publisher) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete publisher error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+int64_t DecimationWriter::get_process_cpu_time()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (static_cast<int64_t>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000
+        + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+void DecimationWriter::run(const uint32_t& numOfInstances, const uint32_t& rate, const uint32_t& duration)
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_writerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    std::cout << "Listeners have been matched successfully." << std::endl;
+    if (m_decimate)
+    {
+        // The QoS of a reader may not be known yet when the match is notified
+        m_decimator.update_matched_readers(m_writer);
+        std::cout << "Writer-side decimation is enabled. Minimum separation of matched readers: "
+                  << m_decimator.get_separation() / 1000000 << " ms" << std::endl;
+    }
+    std::cout << "\nPublishing " << numOfInstances << " instances at " << rate << " Hz for "
+              << duration << " s..." << std::endl;
+
+    // Keys start from 1, the handle of key 0 is identical to HANDLE_NIL
+    std::vector<greenstone::dds::InstanceHandle_t> handles;
+    for (uint32_t i = 1; i <= numOfInstances; i++)
+    {
+        m_decimation.id(i);
+        handles.push_back(m_writer->register_instance(&m_decimation));
+    }
+
+    uint64_t written = 0;
+    uint64_t skipped = 0;
+    uint64_t ticks = static_cast<uint64_t>(rate) * duration;
+    auto period = std::chrono::nanoseconds(1000000000 / (rate > 0 ? rate : 1));
+    auto next = std::chrono::steady_clock::now();
+    int64_t cpuStart = get_process_cpu_time();
+
+    for (uint64_t tick = 1; tick <= ticks; tick++)
+    {
+        auto now = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < numOfInstances; i++)
+        {
+            if (m_decimate && !m_decimator.is_due(handles[i], now))
+            {
+                ++skipped;
+                continue;
+            }
+
+            m_decimation.id(i + 1);
+            m_decimation.index(tick);
+            m_decimation.values().fill(static_cast<double>(tick));
+            if (m_writer->write(&m_decimation, handles[i]) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+            {
+                ++written;
+            }
+        }
+
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+
+    int64_t cpuUsed = get_process_cpu_time() - cpuStart;
+    std::cout << "\n[writer] generated: " << ticks * numOfInstances
+              << "; written: " << written
+              << "; skipped: " << skipped
+              << "; CPU: " << cpuUsed << " us\n" << std::endl;
+
+    for (uint32_t i = 0; i < numOfInstances; i++)
+    {
+        m_decimation.id(i + 1);
+        if (m_writer->unregister_instance(&m_decimation, handles[i]) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            std::cout << "Unregister instance error" << std::endl;
+        }
+        m_decimator.remove_instance(handles[i]);
+    }
+
+    // Leave time for the last samples to be acknowledged before the reader sees the writer leave
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    destroy();
+}
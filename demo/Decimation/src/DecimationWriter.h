@@ -0,0 +1,77 @@
+/**************************************************************
+* @file DecimationWriter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef DECIMATION_WRITER_H
+#define DECIMATION_WRITER_H
+
+#include <vector>
+
+#include "GeneralListeners.h"
+#include "WriterDecimator.h"
+#include "DecimationTopicDataType.h"
+
+/**
+* @class DecimationWriter
+* @brief A wrapper class publishing Decimation topic at a fixed rate for a number of instances,
+*        optionally skipping the samples that all matched readers would drop by time_based_filter.
+* @note
+*/
+
+class DecimationWriter
+{
+public:
+
+    DecimationWriter();
+
+    ~DecimationWriter();
+
+    // Initialize DDS entities for publishing Decimation topic
+    bool init(const std::string& topicName, const bool& decimate);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Publish every instance at the given rate for a duration (second)
+    void run(const uint32_t& numOfInstances, const uint32_t& rate, const uint32_t& duration);
+
+private:
+
+    // Get the CPU time consumed by this process (microsecond)
+    int64_t get_process_cpu_time();
+
+    // Instance of Decimation and DecimationTopicDataType
+    Decimation m_decimation;
+    DecimationTopicDataType m_decimationTopicType;
+
+    // DDS entities for DataWriter
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Publisher* m_publisher;
+    greenstone::dds::DataWriter* m_writer;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // Writer-side decimation according to the time_based_filter of matched readers
+    bool m_decimate;
+    WriterDecimator m_decimator;
+
+    // A child class of GeneralWriterListener refreshing the decimator when readers come and go
+    class MyDataWriterListener : public GeneralWriterListener
+    {
+    public:
+        explicit MyDataWriterListener(WriterDecimator* decimator) : m_decimator(decimator) {}
+        ~MyDataWriterListener() {}
+
+        // Callback function on_publication_matched
+        void on_publication_matched(
+            greenstone::dds::DataWriter* writer,
+            greenstone::dds::PublicationMatchedStatus const& status) noexcept override;
+
+    private:
+        WriterDecimator* m_decimator;
+    }* m_writerListener;
+};
+
+#endif  // DECIMATION_WRITER_H
@@ -0,0 +1,169 @@
+/**************************************************************
+* @file Instances.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "Instances.h"
+#include "swiftdds/rtps/CdrSize.h"
+//#include <iostream>
+
+Instances::Instances()
+{
+	m_id = 0;
+	m_index = 0;
+
+}
+
+DdsCdr& Instances::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_message);
+
+	return cdr;
+}
+uint32_t Instances::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	Instances* pData = static_cast<Instances*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& Instances::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_message);
+
+	return cdr;
+}
+bool Instances::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	Instances* pData = static_cast<Instances*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool Instances::is_key_defined()
+{
+	return true;
+
+}
+void Instances::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void Instances::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(uint32_t);
+	}
+
+}
+bool Instances::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool Instances::is_plain_types()
+{
+	return false;
+}
+uint32_t Instances::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_message);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const Instances::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void Instances::set_key_val(Instances const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+greenstone::dds::DynamicType_ptr Instances::get_dynamic_type()
+{
+	greenstone::dds::DynamicTypeBuilder* type_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+	type_builder->add_member(0, "id", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->apply_annotation_to_member(0, *(greenstone::dds::AnnotationDescriptorFactory::get_instance()->create_annotation_descriptor_with_key()));
+	type_builder->add_member(1, "index", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->add_member(2, "message", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_string_type());
+	type_builder->set_name("InstancesTopicDataType");
+	return type_builder->build();
+
+}
+void Instances::id(uint32_t const _id)
+{
+	m_id = _id;
+}
+uint32_t Instances::id() const
+{
+	return m_id;
+}
+uint32_t& Instances::id()
+{
+	return m_id;
+}
+
+void Instances::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t Instances::index() const
+{
+	return m_index;
+}
+uint32_t& Instances::index()
+{
+	return m_index;
+}
+
+void Instances::message(std::string const &_message)
+{
+	m_message = _message;
+}
+void Instances::message(std::string &&_message)
+{
+	m_message = std::move(_message);
+}
+std::string const& Instances::message() const
+{
+	return m_message;
+}
+std::string& Instances::message()
+{
+	return m_message;
+}
+
@@ -0,0 +1,176 @@
+/**************************************************************
+* @file InstancesTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "InstancesTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+InstancesTopicDataType::InstancesTopicDataType() : TopicDataType()
+{
+	set_name("InstancesTopicDataType");
+}
+InstancesTopicDataType::~InstancesTopicDataType()
+{
+
+}
+bool InstancesTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	Instances* pData = static_cast<Instances*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool InstancesTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	Instances* pData = static_cast<Instances*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool InstancesTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Instances::is_key_defined())
+	{
+		return false;
+	}
+	Instances* pData = static_cast<Instances*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool InstancesTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Instances::is_key_defined())
+	{
+		return false;
+	}
+	Instances *data = new Instances{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool InstancesTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)Instances;
+
+	return true;
+}
+uint32_t InstancesTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	Instances* pData = static_cast<Instances*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool InstancesTopicDataType::is_with_key() noexcept
+{
+	return Instances::is_key_defined();
+}
+bool InstancesTopicDataType::is_plain_types() noexcept
+{
+	return Instances::is_plain_types();
+}
+void* InstancesTopicDataType::create_data_resource() noexcept
+{
+	Instances* pData = new Instances;
+
+	return pData;
+}
+void InstancesTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	Instances* pData = reinterpret_cast<Instances*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const InstancesTopicDataType::get_serialized_payload_header() noexcept
+{
+	return Instances::get_serialized_payload_header();
+}
+
+void* const InstancesTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Instances* pData = reinterpret_cast<Instances*>(data);
+	Instances* newData = new Instances{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const InstancesTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Instances *data = new Instances{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void InstancesTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	Instances* pData = reinterpret_cast<Instances*>(data);
+	Instances const* const keyData = reinterpret_cast<Instances const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t InstancesTopicDataType::data_size_of() noexcept
+{
+	return sizeof(Instances);
+}
+
+greenstone::dds::DynamicType_ptr const InstancesTopicDataType::get_dynamic_type() noexcept
+{
+	greenstone::dds::DynamicType_ptr ptr = Instances::get_dynamic_type();
+
+	return ptr;
+}
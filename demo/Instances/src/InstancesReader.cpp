@@ -0,0 +1,465 @@
+/**************************************************************
+* @file InstancesReader.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include "InstancesReader.h"
+#include "ConfigParser.h"
+
+InstancesReader::InstancesReader()
+    : m_participant(nullptr),
+      m_topic(nullptr),
+      m_subscriber(nullptr),
+      m_reader(nullptr),
+      m_readerListener(new MyDataReaderListener())
+{
+}
+
+InstancesReader::~InstancesReader()
+{
+    delete m_readerListener;
+}
+
+bool InstancesReader::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_sub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_instancesTopicType);
+    std::string topicTypeName = m_instancesTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create subscriber
+    m_subscriber = ConfigParser::get_instance()->get_subscriber_from_json(
+        "subscriber_cfg", m_participant, nullptr, m_mask);
+    if (m_subscriber == nullptr)
+    {
+        return false;
+    }
+
+    // Create datareader
+    m_reader = ConfigParser::get_instance()->get_reader_from_json(
+        "reader_cfg", m_subscriber, m_topic, m_readerListener, m_mask);
+    if (m_reader == nullptr)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void InstancesReader::destroy()
+{
+    if (m_subscriber->delete_datareader(m_reader) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete reader error" << std::endl;
+    }
+    if (m_participant->delete_subscriber(m_subscriber) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete subscriber error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+uint32_t InstancesReader::read_next_instance_walk(std::vector<greenstone::dds::InstanceHandle_t>* handles)
+{
+    greenstone::dds::SamplesCollectionDerived<Instances> samples;
+    greenstone::dds::SampleInfoSeq infos;
+    greenstone::dds::InstanceHandle_t previous = greenstone::dds::HANDLE_NIL;
+    uint32_t steps = 0;
+
+    while ((m_reader->read_next_instance(samples, infos, 1, previous) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+        && !infos.empty())
+    {
+        previous = infos[0].instance_handle;
+        if (handles != nullptr)
+        {
+            handles->push_back(previous);
+        }
+        ++steps;
+
+        m_reader->return_loan(samples, infos);
+        samples.clear_resource();
+        infos.clear();
+    }
+
+    return steps;
+}
+
+uint32_t InstancesReader::read_instance_by_handle(const std::vector<greenstone::dds::InstanceHandle_t>& handles)
+{
+    greenstone::dds::SamplesCollectionDerived<Instances> samples;
+    greenstone::dds::SampleInfoSeq infos;
+    uint32_t steps = 0;
+
+    for (const greenstone::dds::InstanceHandle_t& handle : handles)
+    {
+        if ((m_reader->read_instance(samples, infos, 1, handle) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+            && !infos.empty())
+        {
+            ++steps;
+        }
+
+        m_reader->return_loan(samples, infos);
+        samples.clear_resource();
+        infos.clear();
+    }
+
+    return steps;
+}
+
+uint32_t InstancesReader::take_next_instance_walk()
+{
+    greenstone::dds::SamplesCollectionDerived<Instances> samples;
+    greenstone::dds::SampleInfoSeq infos;
+    greenstone::dds::InstanceHandle_t previous = greenstone::dds::HANDLE_NIL;
+    uint32_t steps = 0;
+
+    greenstone::dds::ReadCondition* condition = m_reader->create_readcondition(
+        greenstone::dds::ANY_SAMPLE_STATE, greenstone::dds::ANY_VIEW_STATE, greenstone::dds::ANY_INSTANCE_STATE);
+    if (condition == nullptr)
+    {
+        std::cout << "Create read condition error" << std::endl;
+        return 0;
+    }
+
+    while ((m_reader->take_next_instance_w_condition(samples, infos, 1, previous, condition) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+        && !infos.empty())
+    {
+        previous = infos[0].instance_handle;
+        ++steps;
+
+        m_reader->return_loan(samples, infos);
+        samples.clear_resource();
+        infos.clear();
+    }
+
+    if (m_reader->delete_readcondition(condition) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete read condition error" << std::endl;
+    }
+
+    return steps;
+}
+
+void InstancesReader::print_result(const char* operation, const uint32_t& steps, const int64_t& elapsedNs)
+{
+    std::cout << "[" << operation << "] instances: " << steps
+              << "; total: " << elapsedNs / 1000 << " us"
+              << "; per instance: " << (steps > 0 ? elapsedNs / steps : 0) << " ns" << std::endl;
+}
+
+bool InstancesReader::wait_for_instances(const uint32_t& numOfInstances)
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_readerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    std::cout << "Listeners have been matched successfully.\n\nWaiting for "
+              << numOfInstances << " instances..." << std::endl;
+
+    // Delivery is reliable and in order, so all instances are cached once the last one is known.
+    // Nothing is read while waiting, so the samples are still NOT_READ when the benchmark starts.
+    Instances last;
+    last.id(numOfInstances);
+    while ((m_readerListener->get_number_of_matched() > 0) &&
+        (m_reader->lookup_instance(&last) == greenstone::dds::HANDLE_NIL))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    if (m_reader->lookup_instance(&last) == greenstone::dds::HANDLE_NIL)
+    {
+        std::cout << "Writer left before all instances were received." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void InstancesReader::take_original_samples(std::vector<DDS::OriginalData>& samples)
+{
+    dds::core::SampleInfo info;
+    while (true)
+    {
+        DDS::OriginalData data;
+        if (m_reader->take_next_sample_original(data, info) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            break;
+        }
+        if (info.valid_data)
+        {
+            samples.push_back(std::move(data));
+        }
+    }
+}
+
+uint64_t InstancesReader::read_deserialized(std::vector<DDS::OriginalData>& samples)
+{
+    greenstone::dds::DynamicTopicDataType dynamicTopicType(m_instancesTopicType.get_dynamic_type());
+    uint64_t sum = 0;
+
+    for (DDS::OriginalData& data : samples)
+    {
+        std::shared_ptr<greenstone::dds::DynamicData> dynamicData =
+            greenstone::dds::DynamicDataFactory::get_instance()->create_data(m_instancesTopicType.get_dynamic_type());
+        DdsCdr cdr;
+        if (!dynamicTopicType.deserialize(cdr, data.getPayload(), dynamicData.get()))
+        {
+            continue;
+        }
+
+        uint32_t id = 0;
+        std::string message;
+        dynamicData->get_uint32_value(id, 0);
+        dynamicData->get_string_value(message, 2);
+        sum += id + message.size();
+    }
+
+    return sum;
+}
+
+uint64_t InstancesReader::read_in_place(std::vector<DDS::OriginalData>& samples, CdrView& view)
+{
+    // Fields are resolved once, each sample only attaches its payload
+    int32_t idField = view.get_field(0);
+    int32_t messageField = view.get_field(2);
+    uint64_t sum = 0;
+
+    for (DDS::OriginalData& data : samples)
+    {
+        if (!view.reset(data))
+        {
+            continue;
+        }
+
+        uint32_t id = 0;
+        const char* message = nullptr;
+        uint32_t length = 0;
+        view.get_uint32_value(id, idField);
+        view.get_string_view(message, length, messageField);
+        sum += id + length;
+    }
+
+    return sum;
+}
+
+uint32_t InstancesReader::filter_deserialized(std::vector<DDS::OriginalData>& samples, const uint32_t& threshold)
+{
+    Instances sample;
+    DdsCdr cdr;
+    uint32_t passed = 0;
+
+    for (DDS::OriginalData& data : samples)
+    {
+        cdr.set_buf(reinterpret_cast<void*>(data.getDataPtr()), data.getDataLength());
+        cdr.deserialize(sample);
+        if (sample.id() > threshold)
+        {
+            ++passed;
+        }
+    }
+
+    return passed;
+}
+
+uint32_t InstancesReader::filter_compiled(std::vector<DDS::OriginalData>& samples, ContentFilter& filter)
+{
+    Instances sample;
+    DdsCdr cdr;
+    uint32_t passed = 0;
+
+    for (DDS::OriginalData& data : samples)
+    {
+        if (!filter.evaluate(data))
+        {
+            continue;
+        }
+        cdr.set_buf(reinterpret_cast<void*>(data.getDataPtr()), data.getDataLength());
+        cdr.deserialize(sample);
+        ++passed;
+    }
+
+    return passed;
+}
+
+void InstancesReader::run(const uint32_t& numOfInstances, const uint32_t& rounds)
+{
+    if (!wait_for_instances(numOfInstances))
+    {
+        destroy();
+        return;
+    }
+
+    std::cout << "\nInstance access benchmark is ongoing..." << std::endl;
+
+    std::vector<greenstone::dds::InstanceHandle_t> handles;
+    handles.reserve(numOfInstances);
+
+    for (uint32_t round = 1; round <= rounds; round++)
+    {
+        std::cout << "\nRound " << round << ":" << std::endl;
+        handles.clear();
+
+        auto start = std::chrono::steady_clock::now();
+        uint32_t steps = read_next_instance_walk(&handles);
+        auto end = std::chrono::steady_clock::now();
+        print_result("read_next_instance", steps,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+        start = std::chrono::steady_clock::now();
+        steps = read_instance_by_handle(handles);
+        end = std::chrono::steady_clock::now();
+        print_result("read_instance", steps,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    // Taking empties the cache, so it can only be measured once at the end
+    std::cout << "\nFinal round:" << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    uint32_t steps = take_next_instance_walk();
+    auto end = std::chrono::steady_clock::now();
+    print_result("take_next_instance_w_condition", steps,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+    std::cout << "\nInstance access benchmark is over.\n" << std::endl;
+
+    destroy();
+}
+
+void InstancesReader::run_filter(const uint32_t& numOfInstances, const uint32_t& rounds)
+{
+    if (!wait_for_instances(numOfInstances))
+    {
+        destroy();
+        return;
+    }
+
+    std::vector<DDS::OriginalData> samples;
+    samples.reserve(numOfInstances);
+    take_original_samples(samples);
+
+    // The expression is compiled once, each selectivity only binds a new parameter
+    ContentFilter filter;
+    if (!filter.compile(m_instancesTopicType.get_dynamic_type(), "id > %0", {"0"}))
+    {
+        std::cout << "Compile content filter error: " << filter.get_error() << std::endl;
+        destroy();
+        return;
+    }
+
+    std::cout << "\nContent filter benchmark over " << samples.size() << " samples is ongoing..." << std::endl;
+
+    for (uint32_t reject : {0U, 50U, 99U})
+    {
+        // Keys start from 1, so "id > threshold" rejects the given percentage of samples
+        uint32_t threshold = static_cast<uint32_t>(static_cast<uint64_t>(numOfInstances) * reject / 100);
+        if (!filter.set_parameters({std::to_string(threshold)}))
+        {
+            std::cout << "Set content filter parameters error: " << filter.get_error() << std::endl;
+            break;
+        }
+
+        std::cout << "\nRejecting " << reject << "%:" << std::endl;
+
+        int64_t deserializedNs = 0;
+        int64_t compiledNs = 0;
+        uint32_t deserializedPassed = 0;
+        uint32_t compiledPassed = 0;
+        for (uint32_t round = 0; round < rounds; round++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            deserializedPassed = filter_deserialized(samples, threshold);
+            auto end = std::chrono::steady_clock::now();
+            deserializedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+            start = std::chrono::steady_clock::now();
+            compiledPassed = filter_compiled(samples, filter);
+            end = std::chrono::steady_clock::now();
+            compiledNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        }
+
+        uint32_t total = static_cast<uint32_t>(samples.size()) * rounds;
+        std::cout << "passed: " << deserializedPassed << " / " << samples.size() << std::endl;
+        print_result("deserialize then filter", total, deserializedNs);
+        print_result("compiled filter on CDR", total, compiledNs);
+        if (compiledPassed != deserializedPassed)
+        {
+            std::cout << "Compiled filter passed " << compiledPassed << " samples instead of "
+                      << deserializedPassed << std::endl;
+        }
+    }
+
+    std::cout << "\nContent filter benchmark is over.\n" << std::endl;
+
+    destroy();
+}
+
+void InstancesReader::run_dynamic(const uint32_t& numOfInstances, const uint32_t& rounds)
+{
+    if (!wait_for_instances(numOfInstances))
+    {
+        destroy();
+        return;
+    }
+
+    std::vector<DDS::OriginalData> samples;
+    samples.reserve(numOfInstances);
+    take_original_samples(samples);
+
+    CdrView view(m_instancesTopicType.get_dynamic_type());
+    if ((view.get_field(0) < 0) || (view.get_field(2) < 0))
+    {
+        std::cout << "Build layout of Instances error." << std::endl;
+        destroy();
+        return;
+    }
+
+    std::cout << "\nDynamic data benchmark over " << samples.size() << " samples is ongoing..." << std::endl;
+
+    int64_t deserializedNs = 0;
+    int64_t inPlaceNs = 0;
+    uint64_t deserializedSum = 0;
+    uint64_t inPlaceSum = 0;
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        deserializedSum = read_deserialized(samples);
+        auto end = std::chrono::steady_clock::now();
+        deserializedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        start = std::chrono::steady_clock::now();
+        inPlaceSum = read_in_place(samples, view);
+        end = std::chrono::steady_clock::now();
+        inPlaceNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+
+    uint32_t total = static_cast<uint32_t>(samples.size()) * rounds;
+    print_result("deserialize into DynamicData", total, deserializedNs);
+    print_result("read in place with CdrView", total, inPlaceNs);
+    if (inPlaceSum != deserializedSum)
+    {
+        std::cout << "CdrView read " << inPlaceSum << " instead of " << deserializedSum << std::endl;
+    }
+
+    std::cout << "\nDynamic data benchmark is over.\n" << std::endl;
+
+    destroy();
+}
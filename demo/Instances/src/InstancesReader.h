@@ -0,0 +1,100 @@
+/**************************************************************
+* @file InstancesReader.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef INSTANCES_READER_H
+#define INSTANCES_READER_H
+
+#include <vector>
+
+#include "GeneralListeners.h"
+#include "ContentFilter.h"
+#include "CdrView.h"
+#include "InstancesTopicDataType.h"
+
+/**
+* @class InstancesReader
+* @brief A wrapper class subscribing Instances topic and timing the instance-ordered access
+*        operations of DataReader over its history cache.
+* @note
+*/
+
+class InstancesReader
+{
+public:
+
+    InstancesReader();
+
+    ~InstancesReader();
+
+    // Initialize DDS entities for subscribing Instances topic
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Wait for all instances to arrive, then benchmark instance access for a number of rounds
+    void run(const uint32_t& numOfInstances, const uint32_t& rounds);
+
+    // Wait for all instances to arrive, take them as serialized samples and benchmark content filtering
+    // by deserializing every sample against running a compiled filter on the serialized samples
+    void run_filter(const uint32_t& numOfInstances, const uint32_t& rounds);
+
+    // Wait for all instances to arrive, take them as serialized samples and benchmark reading two fields
+    // by deserializing every sample into a DynamicData against reading them in place with a CdrView
+    void run_dynamic(const uint32_t& numOfInstances, const uint32_t& rounds);
+
+private:
+
+    // Wait for the writer to be matched and all instances to be in the reader cache
+    bool wait_for_instances(const uint32_t& numOfInstances);
+
+    // Step through all instances with read_next_instance, collecting their handles if requested
+    uint32_t read_next_instance_walk(std::vector<greenstone::dds::InstanceHandle_t>* handles);
+
+    // Access every instance directly by handle with read_instance
+    uint32_t read_instance_by_handle(const std::vector<greenstone::dds::InstanceHandle_t>& handles);
+
+    // Step through all instances with take_next_instance_w_condition, emptying the cache
+    uint32_t take_next_instance_walk();
+
+    // Take all samples in the reader cache without deserializing them
+    void take_original_samples(std::vector<DDS::OriginalData>& samples);
+
+    // Read the fields id and message of every sample from a fully deserialized DynamicData, return the sum of both
+    uint64_t read_deserialized(std::vector<DDS::OriginalData>& samples);
+
+    // Read the fields id and message of every sample in place with a CdrView, return the sum of both
+    uint64_t read_in_place(std::vector<DDS::OriginalData>& samples, CdrView& view);
+
+    // Filter the samples by deserializing each one and testing the key, return the number passed
+    uint32_t filter_deserialized(std::vector<DDS::OriginalData>& samples, const uint32_t& threshold);
+
+    // Filter the samples with the compiled filter, only deserializing those passed
+    uint32_t filter_compiled(std::vector<DDS::OriginalData>& samples, ContentFilter& filter);
+
+    // Print the result of one benchmarked operation
+    void print_result(const char* operation, const uint32_t& steps, const int64_t& elapsedNs);
+
+    // Instance of InstancesTopicDataType
+    InstancesTopicDataType m_instancesTopicType;
+
+    // DDS entities for DataReader
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Subscriber* m_subscriber;
+    greenstone::dds::DataReader* m_reader;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // A child class of GeneralReaderListener
+    class MyDataReaderListener : public GeneralReaderListener
+    {
+    public:
+        MyDataReaderListener() {}
+        ~MyDataReaderListener() {}
+    }* m_readerListener;
+};
+
+#endif  // INSTANCES_READER_H
@@ -0,0 +1,59 @@
+/**************************************************************
+* @file InstancesWriter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef INSTANCES_WRITER_H
+#define INSTANCES_WRITER_H
+
+#include "GeneralListeners.h"
+#include "InstancesTopicDataType.h"
+
+/**
+* @class InstancesWriter
+* @brief A wrapper class publishing one sample for each instance of Instances topic.
+* @note
+*/
+
+class InstancesWriter
+{
+public:
+
+    InstancesWriter();
+
+    ~InstancesWriter();
+
+    // Initialize DDS entities for publishing Instances topic
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Publish one sample per instance and stay alive until the reader leaves
+    void run(const uint32_t& numOfInstances, const uint32_t& dataSize);
+
+private:
+
+    // Instance of Instances and InstancesTopicDataType
+    Instances m_instances;
+    InstancesTopicDataType m_instancesTopicType;
+
+    // DDS entities for DataWriter
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Publisher* m_publisher;
+    greenstone::dds::DataWriter* m_writer;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+    greenstone::dds::InstanceHandle_t m_handle;
+
+    // A child class of GeneralWriterListener
+    class MyDataWriterListener : public GeneralWriterListener
+    {
+    public:
+        MyDataWriterListener() {}
+        ~MyDataWriterListener() {}
+    }* m_writerListener;
+};
+
+#endif  // INSTANCES_WRITER_H
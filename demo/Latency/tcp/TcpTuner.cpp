@@ -0,0 +1,147 @@
+/**************************************************************
+* @file TcpTuner.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+// Preloaded into a participant to tune the TCP connections of the TCPv4 transport. Every RTPS message is sent
+// as a 4-byte length prefix followed by the message, in two send calls, so the prefix leaves in a segment of
+// its own and the receiving side handles the message only about half a millisecond later. The prefix is sent
+// with MSG_MORE unless TCP_COALESCE=0, so that it leaves in the same segment as the message without being
+// copied. A prefix is only held back on a connection already seen sending a prefix followed by the RTPS
+// message of that length, so any other 4-byte send, which may not be followed by anything, leaves at once.
+// TCP_NODELAY=1 also turns off Nagle's algorithm on every connection made or accepted. send, connect and
+// accept are interposed for the whole process, including the sockets of the application itself.
+
+#include <dlfcn.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+    typedef int (*ConnectFunc)(int, const struct sockaddr*, socklen_t);
+    typedef int (*AcceptFunc)(int, struct sockaddr*, socklen_t*);
+    typedef ssize_t (*SendFunc)(int, const void*, size_t, int);
+
+    const size_t PREFIX_SIZE = 4;
+    const size_t RTPS_HEADER_SIZE = 20;
+    const uint32_t MAX_MESSAGE_SIZE = 64U << 20;
+
+    // Framing seen on a connection, by file descriptor
+    enum Framing : uint8_t
+    {
+        // Nothing known yet
+        UNKNOWN,
+        // The last send was a length prefix sent as is, the next one tells if it was followed by its message
+        PREFIX_SENT,
+        // Every length prefix is followed by its RTPS message
+        RTPS_FRAMED
+    };
+
+    // Connections with larger descriptors are left as they are
+    const int MAX_FDS = 65536;
+    std::atomic<uint8_t> g_framing[MAX_FDS];
+    std::atomic<uint32_t> g_expected[MAX_FDS];
+
+    // Read a switch from the environment, 0 for off and any other value for on
+    bool is_enabled(const char* name, bool defaultValue)
+    {
+        const char* value = std::getenv(name);
+        return (value == nullptr) ? defaultValue : (std::strcmp(value, "0") != 0);
+    }
+
+    bool is_tcp(int fd)
+    {
+        int type = 0;
+        socklen_t length = sizeof(type);
+        return (getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &length) == 0) && (type == SOCK_STREAM);
+    }
+
+    // Length of the message a 4-byte send announces, 0 if it cannot be a length prefix of the transport
+    uint32_t get_announced_length(const void* buf)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(buf);
+        uint32_t length = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+            (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        return ((length >= RTPS_HEADER_SIZE) && (length <= MAX_MESSAGE_SIZE)) ? length : 0;
+    }
+
+    // Forget the framing of a descriptor used by a new connection
+    void reset_framing(int fd)
+    {
+        if ((fd >= 0) && (fd < MAX_FDS))
+        {
+            g_framing[fd].store(UNKNOWN, std::memory_order_relaxed);
+        }
+    }
+
+    void set_no_delay(int fd)
+    {
+        static const bool enabled = is_enabled("TCP_NODELAY", false);
+        if (enabled && is_tcp(fd))
+        {
+            int on = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        }
+    }
+}
+
+extern "C" int connect(int fd, const struct sockaddr* addr, socklen_t addrLen)
+{
+    static ConnectFunc realConnect = reinterpret_cast<ConnectFunc>(dlsym(RTLD_NEXT, "connect"));
+    int ret = realConnect(fd, addr, addrLen);
+    reset_framing(fd);
+    set_no_delay(fd);
+    return ret;
+}
+
+extern "C" int accept(int fd, struct sockaddr* addr, socklen_t* addrLen)
+{
+    static AcceptFunc realAccept = reinterpret_cast<AcceptFunc>(dlsym(RTLD_NEXT, "accept"));
+    int ret = realAccept(fd, addr, addrLen);
+    if (ret >= 0)
+    {
+        reset_framing(ret);
+        set_no_delay(ret);
+    }
+    return ret;
+}
+
+extern "C" ssize_t send(int fd, const void* buf, size_t len, int flags)
+{
+    static SendFunc realSend = reinterpret_cast<SendFunc>(dlsym(RTLD_NEXT, "send"));
+    static const bool coalesce = is_enabled("TCP_COALESCE", true);
+    if (!coalesce || (fd < 0) || (fd >= MAX_FDS) || (buf == nullptr))
+    {
+        return realSend(fd, buf, len, flags);
+    }
+
+    uint8_t framing = g_framing[fd].load(std::memory_order_relaxed);
+    uint32_t announced = (len == PREFIX_SIZE) ? get_announced_length(buf) : 0;
+    if (announced > 0)
+    {
+        if (framing == RTPS_FRAMED)
+        {
+            // The message follows on this connection, the prefix waits for it in the socket
+            flags |= MSG_MORE;
+        }
+        else if (is_tcp(fd))
+        {
+            // Sent as is until the connection is known to carry the framing of the transport
+            g_expected[fd].store(announced, std::memory_order_relaxed);
+            g_framing[fd].store(PREFIX_SENT, std::memory_order_relaxed);
+        }
+    }
+    else if (framing == PREFIX_SENT)
+    {
+        bool framed = (len == g_expected[fd].load(std::memory_order_relaxed)) && (len >= RTPS_HEADER_SIZE) &&
+            (std::memcmp(buf, "RTPS", 4) == 0);
+        g_framing[fd].store(framed ? RTPS_FRAMED : UNKNOWN, std::memory_order_relaxed);
+    }
+    return realSend(fd, buf, len, flags);
+}
@@ -0,0 +1,172 @@
+/**************************************************************
+* @file Persistence.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "Persistence.h"
+#include "swiftdds/rtps/CdrSize.h"
+//#include <iostream>
+
+Persistence::Persistence()
+{
+	m_id = 0;
+	m_index = 0;
+
+}
+
+DdsCdr& Persistence::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_data);
+
+	return cdr;
+}
+uint32_t Persistence::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	Persistence* pData = static_cast<Persistence*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& Persistence::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_data);
+
+	return cdr;
+}
+bool Persistence::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	Persistence* pData = static_cast<Persistence*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool Persistence::is_key_defined()
+{
+	return true;
+
+}
+void Persistence::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void Persistence::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(uint32_t);
+	}
+
+}
+bool Persistence::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool Persistence::is_plain_types()
+{
+	return false;
+}
+uint32_t Persistence::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_data);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const Persistence::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void Persistence::set_key_val(Persistence const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+greenstone::dds::DynamicType_ptr Persistence::get_dynamic_type()
+{
+	greenstone::dds::DynamicTypeBuilder* type_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+	type_builder->add_member(0, "id", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->apply_annotation_to_member(0, *(greenstone::dds::AnnotationDescriptorFactory::get_instance()->create_annotation_descriptor_with_key()));
+	type_builder->add_member(1, "index", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint64_type());
+	greenstone::dds::DynamicType_ptr data_base_type = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint8_type();
+	greenstone::dds::DynamicTypeBuilder* data_sequence_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_sequence_builder(data_base_type);
+	greenstone::dds::DynamicType_ptr data_seq_type = data_sequence_builder->build();
+	type_builder->add_member(2, "data", data_seq_type);
+	type_builder->set_name("PersistenceTopicDataType");
+	return type_builder->build();
+
+}
+void Persistence::id(uint32_t const _id)
+{
+	m_id = _id;
+}
+uint32_t Persistence::id() const
+{
+	return m_id;
+}
+uint32_t& Persistence::id()
+{
+	return m_id;
+}
+
+void Persistence::index(uint64_t const _index)
+{
+	m_index = _index;
+}
+uint64_t Persistence::index() const
+{
+	return m_index;
+}
+uint64_t& Persistence::index()
+{
+	return m_index;
+}
+
+void Persistence::data(std::vector<unsigned char> const &_data)
+{
+	m_data = _data;
+}
+void Persistence::data(std::vector<unsigned char> &&_data)
+{
+	m_data = std::move(_data);
+}
+std::vector<unsigned char> const& Persistence::data() const
+{
+	return m_data;
+}
+std::vector<unsigned char>& Persistence::data()
+{
+	return m_data;
+}
+
@@ -0,0 +1,87 @@
+/**************************************************************
+* @file Persistence.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#ifndef PERSISTENCE_967845fd5cb5bc9ef58da8d0b92a43ef_H
+#define PERSISTENCE_967845fd5cb5bc9ef58da8d0b92a43ef_H
+
+#include <stdint.h>
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+#include "swiftdds/rtps/DdsOptionalMember.h"
+
+
+
+
+/**
+* @class Persistence
+* @brief A class as the datatype for data exchange.
+* @note
+*/
+
+class Persistence
+{
+public:
+	static constexpr bool IS_KEY_DEFINED = true;
+	static constexpr uint32_t DATA_SIZE = 0U;
+	static constexpr bool IS_DATA_PADDING = true;
+	static constexpr bool IS_ID_DEFINED = false;
+
+	Persistence();
+	~Persistence() = default;
+	Persistence(Persistence const &x) = default;
+	Persistence(Persistence &&x) = default;
+	Persistence& operator=(Persistence const &x) = default;
+	Persistence& operator=(Persistence &&x) = default;
+
+	DdsCdr& serialize(DdsCdr &cdr) const;
+	static uint32_t serialize(void *const data, char *const payload_buf, uint32_t const payload_len);
+
+	DdsCdr& deserialize(DdsCdr &cdr);
+	static bool deserialize(char *const payload_buf, uint32_t const payload_len, void *const data);
+
+	static bool is_key_defined();
+	void serialize_key(DdsCdr &cdr) const;
+
+	void serialize_key(char **buf,unsigned int *len);
+	bool is_key_serialize_by_cdr();
+	static bool is_plain_types();
+	uint32_t max_align_size(uint32_t const _cur_al) const;
+	static greenstone::dds::SerializedPayloadHeader const get_serialized_payload_header();
+	void set_key_val(Persistence const* const _data) noexcept;
+	static greenstone::dds::DynamicType_ptr get_dynamic_type();
+
+
+
+	void id(uint32_t const _id);
+	uint32_t id() const;
+	uint32_t& id();
+
+	void index(uint64_t const _index);
+	uint64_t index() const;
+	uint64_t& index();
+
+	void data(std::vector<unsigned char> const &_data);
+	void data(std::vector<unsigned char> &&_data);
+	std::vector<unsigned char> const& data() const;
+	std::vector<unsigned char>& data();
+
+
+
+
+
+private:
+	uint32_t m_id;
+	uint64_t m_index;
+	std::vector<unsigned char> m_data;
+
+};
+
+
+#endif	// PERSISTENCE_967845fd5cb5bc9ef58da8d0b92a43ef_H
+
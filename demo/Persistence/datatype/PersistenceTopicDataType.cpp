@@ -0,0 +1,176 @@
+/**************************************************************
+* @file PersistenceTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "PersistenceTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+PersistenceTopicDataType::PersistenceTopicDataType() : TopicDataType()
+{
+	set_name("PersistenceTopicDataType");
+}
+PersistenceTopicDataType::~PersistenceTopicDataType()
+{
+
+}
+bool PersistenceTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	Persistence* pData = static_cast<Persistence*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool PersistenceTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	Persistence* pData = static_cast<Persistence*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool PersistenceTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Persistence::is_key_defined())
+	{
+		return false;
+	}
+	Persistence* pData = static_cast<Persistence*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool PersistenceTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Persistence::is_key_defined())
+	{
+		return false;
+	}
+	Persistence *data = new Persistence{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool PersistenceTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)Persistence;
+
+	return true;
+}
+uint32_t PersistenceTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	Persistence* pData = static_cast<Persistence*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool PersistenceTopicDataType::is_with_key() noexcept
+{
+	return Persistence::is_key_defined();
+}
+bool PersistenceTopicDataType::is_plain_types() noexcept
+{
+	return Persistence::is_plain_types();
+}
+void* PersistenceTopicDataType::create_data_resource() noexcept
+{
+	Persistence* pData = new Persistence;
+
+	return pData;
+}
+void PersistenceTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	Persistence* pData = reinterpret_cast<Persistence*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const PersistenceTopicDataType::get_serialized_payload_header() noexcept
+{
+	return Persistence::get_serialized_payload_header();
+}
+
+void* const PersistenceTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Persistence* pData = reinterpret_cast<Persistence*>(data);
+	Persistence* newData = new Persistence{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const PersistenceTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Persistence *data = new Persistence{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void PersistenceTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	Persistence* pData = reinterpret_cast<Persistence*>(data);
+	Persistence const* const keyData = reinterpret_cast<Persistence const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t PersistenceTopicDataType::data_size_of() noexcept
+{
+	return sizeof(Persistence);
+}
+
+greenstone::dds::DynamicType_ptr const PersistenceTopicDataType::get_dynamic_type() noexcept
+{
+	greenstone::dds::DynamicType_ptr ptr = Persistence::get_dynamic_type();
+
+	return ptr;
+}
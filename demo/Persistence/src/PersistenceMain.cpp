@@ -0,0 +1,302 @@
+/**************************************************************
+* @file PersistenceMain.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "PersistenceWriter.h"
+#include "PersistenceReader.h"
+#include "ConfigParser.h"
+
+enum ParseResult
+{
+    SUCCESS,
+    FAILURE
+};
+
+enum NodeType
+{
+    UNDEFINED,
+    PUBLISHER,
+    SUBSCRIBER
+};
+
+struct ParsedArguments
+{
+    NodeType nodeType;
+    std::string cfgPath;
+    std::string topicName;
+    uint32_t numOfKeys;
+    uint32_t numOfSamples;
+    uint32_t dataByte;
+    std::string logPath;
+    uint64_t commitBytes;
+    bool waitFirst;
+    ParseResult parseResult;
+};
+
+inline bool exists (const std::string& name)
+{
+    if (FILE* file = fopen(name.c_str(), "r"))
+    {
+        fclose(file);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+inline ParsedArguments parse_arguments(int argc, char* argv[])
+{
+    ParsedArguments parsedArguments;
+    parsedArguments.nodeType = NodeType::UNDEFINED;
+    parsedArguments.cfgPath = "config.json";
+    parsedArguments.topicName = "Persistence";
+    parsedArguments.numOfKeys = 1024;
+    parsedArguments.numOfSamples = 4096;
+    parsedArguments.dataByte = 65536;
+    parsedArguments.logPath = "";
+    parsedArguments.commitBytes = 4194304;
+    parsedArguments.waitFirst = false;
+    parsedArguments.parseResult = ParseResult::SUCCESS;
+
+    int argCount = 1;
+    bool printHelp = false;
+
+    while (argCount < argc)
+    {
+        if (strcmp(argv[argCount], "-h") == 0 || strcmp(argv[argCount], "--help") == 0)
+        {
+            std::cout << "List of arguments.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+        else if (strcmp(argv[argCount], "-n") == 0 || strcmp(argv[argCount], "--node-type") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Node type is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else if (strcmp(argv[argCount + 1], "pub") == 0 || strcmp(argv[argCount + 1], "publisher") == 0)
+            {
+                parsedArguments.nodeType = NodeType::PUBLISHER;
+            }
+            else if (strcmp(argv[argCount + 1], "sub") == 0 || strcmp(argv[argCount + 1], "subscriber") == 0)
+            {
+                parsedArguments.nodeType = NodeType::SUBSCRIBER;
+            }
+            else
+            {
+                std::cout << "Node type needs to be assigned as a 'publisher' or 'subscriber'" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-c") == 0 || strcmp(argv[argCount], "--config-path") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Configuration file is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.cfgPath = argv[argCount + 1];
+                if (!exists(parsedArguments.cfgPath))
+                {
+                    std::cout << "Configuration file does not exist or the path is wrong" << std::endl;
+                    parsedArguments.parseResult = ParseResult::FAILURE;
+                    break;
+                }
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-t") == 0 || strcmp(argv[argCount], "--topic-name") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Topic name is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.topicName = argv[argCount + 1];
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-k") == 0 || strcmp(argv[argCount], "--number-of-keys") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of keys is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.numOfKeys = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-s") == 0 || strcmp(argv[argCount], "--number-of-samples") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of samples is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.numOfSamples = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-b") == 0 || strcmp(argv[argCount], "--data-byte") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Data byte is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.dataByte = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-p") == 0 || strcmp(argv[argCount], "--log-path") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Path of history log is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.logPath = argv[argCount + 1];
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-f") == 0 || strcmp(argv[argCount], "--commit-bytes") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Commit bytes is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.commitBytes = strtoull(argv[argCount + 1], nullptr, 10);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-w") == 0 || strcmp(argv[argCount], "--wait-first") == 0)
+        {
+            parsedArguments.waitFirst = true;
+            argCount += 1;
+        }
+        else
+        {
+            std::cout << "Wrong arguments. Please check optional arguments as below.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+    }
+
+    if (printHelp)
+    {
+        std::cout << "Usage:\n"\
+                    "    -n, --node-type        <string>      Type of application node\n"
+                    "                                         Values: publisher, pub, subscriber, sub\n"\
+                    "                                         Default: undefined\n"\
+                    "    -c, --config-path      <string>      Path of configuration file\n"\
+                    "                                         Default: ./config.json\n"
+                    "    -t, --topic-name       <string>      Topic name that is used to match writer and reader\n"\
+                    "                                         Default: Persistence\n"
+                    "    -k, --number-of-keys   <int>         Number of keys the samples are spread over\n"\
+                    "                                         MUST be the same on Writer and Reader\n"
+                    "                                         Default: 1024\n"
+                    "    -s, --number-of-samples <int>        Number of samples to be sent, 0 to publish the history log again\n"\
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 4096\n"
+                    "    -b, --data-byte        <int>         Size of the data of each sample (byte)\n"
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 65536\n"
+                    "    -p, --log-path         <string>      Existing directory of the history log, no log if not given\n"
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: undefined\n"
+                    "    -f, --commit-bytes     <int>         Number of bytes appended to the log between two flushes to disk\n"
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 4194304\n"
+                    "    -w, --wait-first                     Wait for the whole history with wait_for_historical_data before\n"
+                    "                                         taking it, instead of taking the samples while they arrive\n"
+                    "                                         ONLY effective on Reader\n"
+        << std::endl;
+    }
+
+    return parsedArguments;
+}
+
+
+int main(int argc, char *argv[])
+{
+    ParsedArguments arguments = parse_arguments(argc, argv);
+
+    if (arguments.parseResult == ParseResult::FAILURE)
+    {
+        return 0;
+    }
+
+    ConfigParser::get_instance()->load_config_file(arguments.cfgPath);
+
+    try
+    {
+        switch (arguments.nodeType)
+        {
+            case NodeType::PUBLISHER:
+            {
+                // Create an instance of DataWriter to publish samples or the history log
+                PersistenceWriter dataWriter;
+                if (dataWriter.init(arguments.topicName, arguments.logPath, arguments.commitBytes))
+                {
+                    dataWriter.run(arguments.numOfKeys, arguments.numOfSamples, arguments.dataByte);
+                }
+                break;
+            }
+            case NodeType::SUBSCRIBER:
+            {
+                // Create an instance of DataReader to catch up on the history as a late joiner
+                PersistenceReader dataReader;
+                if (dataReader.init(arguments.topicName))
+                {
+                    dataReader.run(arguments.numOfKeys, arguments.waitFirst);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Exception in run(): " << ex.what() << std::endl;
+        return 0;
+    }
+    return 0;
+}
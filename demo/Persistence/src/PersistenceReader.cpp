@@ -0,0 +1,143 @@
+/**************************************************************
+* @file PersistenceReader.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include "PersistenceReader.h"
+#include "ConfigParser.h"
+
+PersistenceReader::PersistenceReader()
+    : m_participant(nullptr),
+      m_topic(nullptr),
+      m_subscriber(nullptr),
+      m_reader(nullptr),
+      m_readerListener(new MyDataReaderListener())
+{
+}
+
+PersistenceReader::~PersistenceReader()
+{
+    delete m_readerListener;
+}
+
+bool PersistenceReader::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_sub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_persistenceTopicType);
+    std::string topicTypeName = m_persistenceTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create subscriber
+    m_subscriber = ConfigParser::get_instance()->get_subscriber_from_json(
+        "subscriber_cfg", m_participant, nullptr, m_mask);
+    if (m_subscriber == nullptr)
+    {
+        return false;
+    }
+
+    // Create datareader
+    m_reader = ConfigParser::get_instance()->get_reader_from_json(
+        "reader_cfg", m_subscriber, m_topic, m_readerListener, m_mask);
+    if (m_reader == nullptr)
+    {
+        return false;
+    }
+    m_created = std::chrono::steady_clock::now();
+
+    return true;
+}
+
+void PersistenceReader::destroy()
+{
+    if (m_subscriber->delete_datareader(m_reader) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete reader error" << std::endl;
+    }
+    if (m_participant->delete_subscriber(m_subscriber) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete subscriber error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+void PersistenceReader::run(const uint32_t& numOfSamples, const bool& waitFirst)
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_readerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto matched = std::chrono::steady_clock::now();
+
+    std::cout << "Listeners have been matched successfully.\n\nCatching up on " << numOfSamples
+              << " samples of history" << (waitFirst ? " after waiting for all of them..." : " while they arrive...")
+              << std::endl;
+
+    // Samples are taken in their serialized form, the benchmark is about delivery and not deserialization
+    const greenstone::dds::Duration_t maxWait(static_cast<uint64_t>(60000));
+    int64_t oldestNs = 0;
+    HistoryCatchUp catchUp(m_reader);
+    HistoryCatchUp::SampleHandler handler = [&oldestNs](DDS::OriginalData&, const dds::core::SampleInfo& info)
+    {
+        int64_t sourceNs = static_cast<int64_t>(info.source_timestamp.seconds()) * 1000000000 + info.source_timestamp.nanosec();
+        if ((oldestNs == 0) || (sourceNs < oldestNs))
+        {
+            oldestNs = sourceNs;
+        }
+    };
+
+    greenstone::dds::ReturnCode_t ret;
+    std::chrono::steady_clock::time_point waited;
+    if (waitFirst)
+    {
+        // The history piles up in the reader cache until the wait returns, then it is taken at once
+        ret = m_reader->wait_for_historical_data(maxWait);
+        waited = std::chrono::steady_clock::now();
+        catchUp.run(greenstone::dds::Duration_t(static_cast<uint64_t>(1)), handler);
+    }
+    else
+    {
+        ret = catchUp.run(maxWait, handler);
+        waited = std::chrono::steady_clock::now();
+    }
+    auto last = std::chrono::steady_clock::now();
+
+    int64_t matchedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(matched - m_created).count();
+    int64_t waitedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(waited - matched).count();
+    int64_t catchUpNs = std::chrono::duration_cast<std::chrono::nanoseconds>(last - matched).count();
+    double seconds = static_cast<double>(catchUpNs) / 1e9;
+    std::cout << "[catch-up] samples: " << catchUp.get_number_of_samples() << " of " << numOfSamples
+              << "; bytes: " << catchUp.get_number_of_bytes() / (1 << 20) << " MB"
+              << "; matched after: " << matchedNs / 1000000 << " ms"
+              << "; historical data after: " << waitedNs / 1000000 << " ms"
+              << (ret == greenstone::dds::ReturnCode_t::RETCODE_OK ? "" : " (not complete)")
+              << "; total: " << catchUpNs / 1000000 << " ms"
+              << "; throughput: " << (seconds > 0 ? static_cast<double>(catchUp.get_number_of_bytes()) / (1 << 20) / seconds : 0.0) << " MB/s"
+              << std::endl;
+    if (oldestNs > 0)
+    {
+        int64_t nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        std::cout << "The oldest sample received was written " << (nowNs - oldestNs) / 1000000000 << " s ago." << std::endl;
+    }
+
+    destroy();
+}
@@ -0,0 +1,64 @@
+/**************************************************************
+* @file PersistenceReader.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef PERSISTENCE_READER_H
+#define PERSISTENCE_READER_H
+
+#include <chrono>
+
+#include "GeneralListeners.h"
+#include "HistoryCatchUp.h"
+#include "PersistenceTopicDataType.h"
+
+/**
+* @class PersistenceReader
+* @brief A wrapper class subscribing Persistence topic as a late joiner and timing how long it takes to
+*        receive the history kept by the writer.
+* @note
+*/
+
+class PersistenceReader
+{
+public:
+
+    PersistenceReader();
+
+    ~PersistenceReader();
+
+    // Initialize DDS entities for subscribing Persistence topic
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Receive the history of the writer while it arrives, or after waiting for all of it, and time it
+    void run(const uint32_t& numOfSamples, const bool& waitFirst);
+
+private:
+
+    // Instance of PersistenceTopicDataType
+    PersistenceTopicDataType m_persistenceTopicType;
+
+    // Time the datareader was created at
+    std::chrono::steady_clock::time_point m_created;
+
+    // DDS entities for DataReader
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Subscriber* m_subscriber;
+    greenstone::dds::DataReader* m_reader;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // A child class of GeneralReaderListener
+    class MyDataReaderListener : public GeneralReaderListener
+    {
+    public:
+        MyDataReaderListener() {}
+        ~MyDataReaderListener() {}
+    }* m_readerListener;
+};
+
+#endif  // PERSISTENCE_READER_H
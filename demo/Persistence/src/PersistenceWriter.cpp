@@ -0,0 +1,269 @@
+/**************************************************************
+* @file PersistenceWriter.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include "PersistenceWriter.h"
+#include "ConfigParser.h"
+
+namespace
+{
+    // Source timestamp of a sample written now
+    DDS::Time_t now()
+    {
+        int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        return DDS::Time_t(static_cast<int32_t>(ns / 1000000000), static_cast<uint32_t>(ns % 1000000000));
+    }
+}
+
+PersistenceWriter::PersistenceWriter()
+    : m_durable(false),
+      m_participant(nullptr),
+      m_topic(nullptr),
+      m_publisher(nullptr),
+      m_writer(nullptr),
+      m_writerListener(new MyDataWriterListener())
+{
+}
+
+PersistenceWriter::~PersistenceWriter()
+{
+    delete m_writerListener;
+}
+
+bool PersistenceWriter::init(const std::string& topicName, const std::string& logPath, const uint64_t& commitBytes)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_pub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_persistenceTopicType);
+    std::string topicTypeName = m_persistenceTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create publisher
+    m_publisher = ConfigParser::get_instance()->get_publisher_from_json(
+        "publisher_cfg", m_participant, nullptr, m_mask);
+    if (m_publisher == nullptr)
+    {
+        return false;
+    }
+
+    // Create datawriter
+    m_writer = ConfigParser::get_instance()->get_writer_from_json(
+        "writer_cfg", m_publisher, m_topic, m_writerListener, m_mask);
+    if (m_writer == nullptr)
+    {
+        return false;
+    }
+
+    if (!logPath.empty())
+    {
+        // The log retains as many samples per instance as the history of the writer
+        greenstone::dds::DataWriterQos writerQos;
+        m_writer->get_qos(writerQos);
+        uint32_t depth = (writerQos.history().kind() == greenstone::dds::HistoryQosPolicyKind::KEEP_ALL_HISTORY_QOS) ?
+            0 : static_cast<uint32_t>(writerQos.history().depth());
+        if (!m_history.open(logPath, topicName, depth, 256ULL << 20, commitBytes))
+        {
+            return false;
+        }
+        m_durable = true;
+        std::cout << "History log " << logPath << " opened with " << m_history.get_number_of_records()
+                  << " samples of " << m_history.get_number_of_instances() << " instances retained." << std::endl;
+    }
+
+    return true;
+}
+
+void PersistenceWriter::destroy()
+{
+    if (m_publisher->delete_datawriter(m_writer) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete writer error" << std::endl;
+    }
+    if (m_participant->delete_publisher(m_publisher) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete publisher error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+
+    // The writer sent the payloads from the mapped log, close it only once the writer is gone
+    m_history.close();
+}
+
+void PersistenceWriter::run(const uint32_t& numOfKeys, const uint32_t& numOfSamples, const uint32_t& dataByte)
+{
+    if (numOfSamples > 0)
+    {
+        publish(numOfKeys, numOfSamples, dataByte);
+    }
+    else if (m_durable)
+    {
+        replay();
+    }
+    else
+    {
+        std::cout << "Nothing to publish, either samples or a history log are needed." << std::endl;
+        destroy();
+        return;
+    }
+
+    std::cout << "\nWaiting for a late-joining reader..." << std::endl;
+
+    while (!(m_writerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    std::cout << "Reader has been matched, waiting for it to catch up and leave..." << std::endl;
+
+    while (m_writerListener->get_number_of_matched() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    destroy();
+}
+
+void PersistenceWriter::publish(const uint32_t& numOfKeys, const uint32_t& numOfSamples, const uint32_t& dataByte)
+{
+    // Keys start from 1, the handle of key 0 is identical to HANDLE_NIL
+    std::vector<greenstone::dds::InstanceHandle_t> handles(numOfKeys);
+    for (uint32_t key = 1; key <= numOfKeys; key++)
+    {
+        m_persistence.id(key);
+        handles[key - 1] = m_writer->register_instance(&m_persistence);
+    }
+    m_persistence.data().assign(dataByte, 0);
+
+    std::cout << "\nSending " << numOfSamples << " samples of " << dataByte << " bytes over " << numOfKeys
+              << " keys " << (m_durable ? "through the history log" : "without history log") << "..." << std::endl;
+
+    uint32_t failed = 0;
+    uint64_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        uint32_t key = i % numOfKeys + 1;
+        m_persistence.id(key);
+        m_persistence.index(i);
+        if (dataByte > 0)
+        {
+            m_persistence.data()[0] = static_cast<uint8_t>(i);
+        }
+
+        if (m_durable)
+        {
+            // Serialize once, the log keeps the payload and the writer sends it from there
+            DdsCdr cdr;
+            std::shared_ptr<greenstone::dds::SerializedPayload_t> payload = std::make_shared<greenstone::dds::SerializedPayload_t>();
+            m_persistenceTopicType.serialize(cdr, &m_persistence, payload);
+            PersistentHistory::Record record;
+            if (!m_history.append(handles[key - 1], payload->value(), payload->length(), now(), record) ||
+                !write_record(record))
+            {
+                ++failed;
+                continue;
+            }
+            bytes += record.length;
+
+            // The samples of a retired segment are out of the writer history once their successors are
+            // acknowledged, until then they may still be sent from its mapped pages. The wait times out
+            // while no reader is matched, then nothing is sent at all
+            if ((m_history.get_number_of_retired() > 0) &&
+                ((m_writerListener->get_number_of_matched() == 0) ||
+                 (m_writer->wait_for_acknowledgements(greenstone::dds::Duration_t(1)) == greenstone::dds::ReturnCode_t::RETCODE_OK)))
+            {
+                m_history.release_retired();
+            }
+        }
+        else
+        {
+            if (m_writer->write_w_timestamp(&m_persistence, handles[key - 1], now()) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+            {
+                ++failed;
+                continue;
+            }
+            bytes += dataByte;
+        }
+    }
+    if (m_durable)
+    {
+        m_history.commit();
+    }
+    int64_t elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    print_result(m_durable ? "write with history log" : "write without history log", numOfSamples - failed, bytes, elapsedNs);
+    std::cout << "Failed writes: " << failed << std::endl;
+    if (m_durable)
+    {
+        std::cout << "History log retains " << m_history.get_number_of_records() << " samples ("
+                  << m_history.get_number_of_bytes() / (1 << 20) << " MB) of "
+                  << m_history.get_number_of_instances() << " instances." << std::endl;
+    }
+}
+
+void PersistenceWriter::replay()
+{
+    std::cout << "\nPublishing " << m_history.get_number_of_records() << " samples of the history log..." << std::endl;
+
+    uint64_t samples = 0;
+    uint64_t bytes = 0;
+    uint32_t failed = 0;
+    auto start = std::chrono::steady_clock::now();
+    m_history.for_each([&](const PersistentHistory::Record& record)
+    {
+        if (write_record(record))
+        {
+            ++samples;
+            bytes += record.length;
+        }
+        else
+        {
+            ++failed;
+        }
+    });
+    int64_t elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    print_result("replay of history log", samples, bytes, elapsedNs);
+    std::cout << "Failed writes: " << failed << std::endl;
+}
+
+bool PersistenceWriter::write_record(const PersistentHistory::Record& record)
+{
+    // The payload is not owned, the writer refers to the mapped log as long as the sample is in its history
+    std::shared_ptr<greenstone::dds::SerializedPayload_t> payload = std::make_shared<greenstone::dds::SerializedPayload_t>(false);
+    payload->value(record.payload);
+    payload->length(record.length);
+    DDS::OriginalData data;
+    data.setPayload(payload);
+    return m_writer->write_original_w_timestamp(data, record.handle, record.timestamp) == greenstone::dds::ReturnCode_t::RETCODE_OK;
+}
+
+void PersistenceWriter::print_result(const char* operation, const uint64_t& samples, const uint64_t& bytes, const int64_t& elapsedNs)
+{
+    double seconds = static_cast<double>(elapsedNs) / 1e9;
+    std::cout << "[" << operation << "] samples: " << samples
+              << "; total: " << elapsedNs / 1000000 << " ms"
+              << "; per sample: " << (samples > 0 ? elapsedNs / static_cast<int64_t>(samples) : 0) << " ns"
+              << "; throughput: " << (seconds > 0 ? static_cast<double>(bytes) / (1 << 20) / seconds : 0.0) << " MB/s"
+              << std::endl;
+}
@@ -0,0 +1,79 @@
+/**************************************************************
+* @file PersistenceWriter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef PERSISTENCE_WRITER_H
+#define PERSISTENCE_WRITER_H
+
+#include <vector>
+
+#include "GeneralListeners.h"
+#include "PersistentHistory.h"
+#include "PersistenceTopicDataType.h"
+
+/**
+* @class PersistenceWriter
+* @brief A wrapper class publishing samples of Persistence topic, optionally keeping them in a PersistentHistory
+*        log so that the history can be published again after the writer restarts.
+* @note
+*/
+
+class PersistenceWriter
+{
+public:
+
+    PersistenceWriter();
+
+    ~PersistenceWriter();
+
+    // Initialize DDS entities for publishing Persistence topic, and open the history log if a path is given
+    bool init(const std::string& topicName, const std::string& logPath, const uint64_t& commitBytes);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Publish samples over a number of keys, or publish the history of the log again if numOfSamples is 0,
+    // then stay alive until a late-joining reader has caught up and left
+    void run(const uint32_t& numOfKeys, const uint32_t& numOfSamples, const uint32_t& dataByte);
+
+private:
+
+    // Publish new samples, through the log if it is open
+    void publish(const uint32_t& numOfKeys, const uint32_t& numOfSamples, const uint32_t& dataByte);
+
+    // Publish the records retained in the log without serializing them again
+    void replay();
+
+    // Write a record of the log with the timestamp it was first written with
+    bool write_record(const PersistentHistory::Record& record);
+
+    // Print the result of publishing
+    void print_result(const char* operation, const uint64_t& samples, const uint64_t& bytes, const int64_t& elapsedNs);
+
+    // Instance of Persistence and PersistenceTopicDataType
+    Persistence m_persistence;
+    PersistenceTopicDataType m_persistenceTopicType;
+
+    // History log, only used if a path is given
+    PersistentHistory m_history;
+    bool m_durable;
+
+    // DDS entities for DataWriter
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Publisher* m_publisher;
+    greenstone::dds::DataWriter* m_writer;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // A child class of GeneralWriterListener
+    class MyDataWriterListener : public GeneralWriterListener
+    {
+    public:
+        MyDataWriterListener() {}
+        ~MyDataWriterListener() {}
+    }* m_writerListener;
+};
+
+#endif  // PERSISTENCE_WRITER_H
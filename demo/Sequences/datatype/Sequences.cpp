@@ -0,0 +1,172 @@
+/**************************************************************
+* @file Sequences.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "Sequences.h"
+#include "swiftdds/rtps/CdrSize.h"
+//#include <iostream>
+
+Sequences::Sequences()
+{
+	m_id = 0;
+	m_index = 0;
+
+}
+
+DdsCdr& Sequences::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_values);
+
+	return cdr;
+}
+uint32_t Sequences::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	Sequences* pData = static_cast<Sequences*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& Sequences::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_values);
+
+	return cdr;
+}
+bool Sequences::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	Sequences* pData = static_cast<Sequences*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool Sequences::is_key_defined()
+{
+	return true;
+
+}
+void Sequences::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void Sequences::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(uint32_t);
+	}
+
+}
+bool Sequences::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool Sequences::is_plain_types()
+{
+	return false;
+}
+uint32_t Sequences::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_values);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const Sequences::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void Sequences::set_key_val(Sequences const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+greenstone::dds::DynamicType_ptr Sequences::get_dynamic_type()
+{
+	greenstone::dds::DynamicTypeBuilder* type_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+	type_builder->add_member(0, "id", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->apply_annotation_to_member(0, *(greenstone::dds::AnnotationDescriptorFactory::get_instance()->create_annotation_descriptor_with_key()));
+	type_builder->add_member(1, "index", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	greenstone::dds::DynamicType_ptr values_base_type = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_float32_type();
+	greenstone::dds::DynamicTypeBuilder* values_sequence_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_sequence_builder(values_base_type);
+	greenstone::dds::DynamicType_ptr values_seq_type = values_sequence_builder->build();
+	type_builder->add_member(2, "values", values_seq_type);
+	type_builder->set_name("SequencesTopicDataType");
+	return type_builder->build();
+
+}
+void Sequences::id(uint32_t const _id)
+{
+	m_id = _id;
+}
+uint32_t Sequences::id() const
+{
+	return m_id;
+}
+uint32_t& Sequences::id()
+{
+	return m_id;
+}
+
+void Sequences::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t Sequences::index() const
+{
+	return m_index;
+}
+uint32_t& Sequences::index()
+{
+	return m_index;
+}
+
+void Sequences::values(std::vector<float> const &_values)
+{
+	m_values = _values;
+}
+void Sequences::values(std::vector<float> &&_values)
+{
+	m_values = std::move(_values);
+}
+std::vector<float> const& Sequences::values() const
+{
+	return m_values;
+}
+std::vector<float>& Sequences::values()
+{
+	return m_values;
+}
+
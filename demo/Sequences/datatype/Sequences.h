@@ -0,0 +1,87 @@
+/**************************************************************
+* @file Sequences.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#ifndef SEQUENCES_33a51851b464575b61246053364ce7e6_H
+#define SEQUENCES_33a51851b464575b61246053364ce7e6_H
+
+#include <stdint.h>
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+#include "swiftdds/rtps/DdsOptionalMember.h"
+
+
+
+
+/**
+* @class Sequences
+* @brief A class as the datatype for data exchange.
+* @note
+*/
+
+class Sequences
+{
+public:
+	static constexpr bool IS_KEY_DEFINED = true;
+	static constexpr uint32_t DATA_SIZE = 0U;
+	static constexpr bool IS_DATA_PADDING = true;
+	static constexpr bool IS_ID_DEFINED = false;
+
+	Sequences();
+	~Sequences() = default;
+	Sequences(Sequences const &x) = default;
+	Sequences(Sequences &&x) = default;
+	Sequences& operator=(Sequences const &x) = default;
+	Sequences& operator=(Sequences &&x) = default;
+
+	DdsCdr& serialize(DdsCdr &cdr) const;
+	static uint32_t serialize(void *const data, char *const payload_buf, uint32_t const payload_len);
+
+	DdsCdr& deserialize(DdsCdr &cdr);
+	static bool deserialize(char *const payload_buf, uint32_t const payload_len, void *const data);
+
+	static bool is_key_defined();
+	void serialize_key(DdsCdr &cdr) const;
+
+	void serialize_key(char **buf,unsigned int *len);
+	bool is_key_serialize_by_cdr();
+	static bool is_plain_types();
+	uint32_t max_align_size(uint32_t const _cur_al) const;
+	static greenstone::dds::SerializedPayloadHeader const get_serialized_payload_header();
+	void set_key_val(Sequences const* const _data) noexcept;
+	static greenstone::dds::DynamicType_ptr get_dynamic_type();
+
+
+
+	void id(uint32_t const _id);
+	uint32_t id() const;
+	uint32_t& id();
+
+	void index(uint32_t const _index);
+	uint32_t index() const;
+	uint32_t& index();
+
+	void values(std::vector<float> const &_values);
+	void values(std::vector<float> &&_values);
+	std::vector<float> const& values() const;
+	std::vector<float>& values();
+
+
+
+
+
+private:
+	uint32_t m_id;
+	uint32_t m_index;
+	std::vector<float> m_values;
+
+};
+
+
+#endif	// SEQUENCES_33a51851b464575b61246053364ce7e6_H
+
@@ -0,0 +1,176 @@
+/**************************************************************
+* @file SequencesTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "SequencesTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+SequencesTopicDataType::SequencesTopicDataType() : TopicDataType()
+{
+	set_name("SequencesTopicDataType");
+}
+SequencesTopicDataType::~SequencesTopicDataType()
+{
+
+}
+bool SequencesTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	Sequences* pData = static_cast<Sequences*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool SequencesTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	Sequences* pData = static_cast<Sequences*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool SequencesTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Sequences::is_key_defined())
+	{
+		return false;
+	}
+	Sequences* pData = static_cast<Sequences*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool SequencesTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Sequences::is_key_defined())
+	{
+		return false;
+	}
+	Sequences *data = new Sequences{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool SequencesTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)Sequences;
+
+	return true;
+}
+uint32_t SequencesTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	Sequences* pData = static_cast<Sequences*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool SequencesTopicDataType::is_with_key() noexcept
+{
+	return Sequences::is_key_defined();
+}
+bool SequencesTopicDataType::is_plain_types() noexcept
+{
+	return Sequences::is_plain_types();
+}
+void* SequencesTopicDataType::create_data_resource() noexcept
+{
+	Sequences* pData = new Sequences;
+
+	return pData;
+}
+void SequencesTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	Sequences* pData = reinterpret_cast<Sequences*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const SequencesTopicDataType::get_serialized_payload_header() noexcept
+{
+	return Sequences::get_serialized_payload_header();
+}
+
+void* const SequencesTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Sequences* pData = reinterpret_cast<Sequences*>(data);
+	Sequences* newData = new Sequences{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const SequencesTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Sequences *data = new Sequences{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void SequencesTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	Sequences* pData = reinterpret_cast<Sequences*>(data);
+	Sequences const* const keyData = reinterpret_cast<Sequences const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t SequencesTopicDataType::data_size_of() noexcept
+{
+	return sizeof(Sequences);
+}
+
+greenstone::dds::DynamicType_ptr const SequencesTopicDataType::get_dynamic_type() noexcept
+{
+	greenstone::dds::DynamicType_ptr ptr = Sequences::get_dynamic_type();
+
+	return ptr;
+}
@@ -0,0 +1,254 @@
+/**************************************************************
+* @file SequencesMain.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "SequencesWriter.h"
+#include "SequencesReader.h"
+#include "ConfigParser.h"
+
+enum ParseResult
+{
+    SUCCESS,
+    FAILURE
+};
+
+enum NodeType
+{
+    UNDEFINED,
+    PUBLISHER,
+    SUBSCRIBER
+};
+
+struct ParsedArguments
+{
+    NodeType nodeType;
+    std::string cfgPath;
+    uint32_t numOfSamples;
+    std::string topicName;
+    uint32_t numOfElements;
+    uint32_t rounds;
+    ParseResult parseResult;
+};
+
+inline bool exists (const std::string& name)
+{
+    if (FILE* file = fopen(name.c_str(), "r"))
+    {
+        fclose(file);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+inline ParsedArguments parse_arguments(int argc, char* argv[])
+{
+    ParsedArguments parsedArguments;
+    parsedArguments.nodeType = NodeType::UNDEFINED;
+    parsedArguments.cfgPath = "config.json";
+    parsedArguments.numOfSamples = 10;
+    parsedArguments.topicName = "Sequences";
+    parsedArguments.numOfElements = 100000;
+    parsedArguments.rounds = 5;
+    parsedArguments.parseResult = ParseResult::SUCCESS;
+
+    int argCount = 1;
+    bool printHelp = false;
+
+    while (argCount < argc)
+    {
+        if (strcmp(argv[argCount], "-h") == 0 || strcmp(argv[argCount], "--help") == 0)
+        {
+            std::cout << "List of arguments.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+        else if (strcmp(argv[argCount], "-n") == 0 || strcmp(argv[argCount], "--node-type") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Node type is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else if (strcmp(argv[argCount + 1], "pub") == 0 || strcmp(argv[argCount + 1], "publisher") == 0)
+            {
+                parsedArguments.nodeType = NodeType::PUBLISHER;
+            }
+            else if (strcmp(argv[argCount + 1], "sub") == 0 || strcmp(argv[argCount + 1], "subscriber") == 0)
+            {
+                parsedArguments.nodeType = NodeType::SUBSCRIBER;
+            }
+            else
+            {
+                std::cout << "Node type needs to be assigned as a 'publisher' or 'subscriber'" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-c") == 0 || strcmp(argv[argCount], "--config-path") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Configuration file is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.cfgPath = argv[argCount + 1];
+                if (!exists(parsedArguments.cfgPath))
+                {
+                    std::cout << "Configuration file does not exist or the path is wrong" << std::endl;
+                    parsedArguments.parseResult = ParseResult::FAILURE;
+                    break;
+                }
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-s") == 0 || strcmp(argv[argCount], "--number-of-samples") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of samples is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.numOfSamples = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-t") == 0 || strcmp(argv[argCount], "--topic-name") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Topic name is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.topicName = argv[argCount + 1];
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-e") == 0 || strcmp(argv[argCount], "--number-of-elements") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of elements is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.numOfElements = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-r") == 0 || strcmp(argv[argCount], "--rounds") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of rounds is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.rounds = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else
+        {
+            std::cout << "Wrong arguments. Please check optional arguments as below.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+    }
+
+    if (printHelp)
+    {
+        std::cout << "Usage:\n"\
+                    "    -n, --node-type        <string>      Type of application node\n"
+                    "                                         Values: publisher, pub, subscriber, sub\n"\
+                    "                                         Default: undefined\n"\
+                    "    -c, --config-path      <string>      Path of configuration file\n"\
+                    "                                         Default: ./config.json\n"
+                    "    -t, --topic-name       <string>      Topic name that is used to match writer and reader\n"\
+                    "                                         Default: Sequences\n"
+                    "    -s, --number-of-samples <int>        Number of samples to be sent, one per key\n"\
+                    "                                         MUST be the same on Writer and Reader\n"
+                    "                                         Default: 10\n"
+                    "    -e, --number-of-elements <int>       Number of float elements in the sequence of each sample\n"\
+                    "                                         ONLY effective on Writer\n"
+                    "                                         Default: 100000\n"
+                    "    -r, --rounds           <int>         Number of benchmark rounds over the cached samples\n"
+                    "                                         ONLY effective on Reader\n"
+                    "                                         Default: 5\n"
+        << std::endl;
+    }
+
+    return parsedArguments;
+}
+
+
+int main(int argc, char *argv[])
+{
+    ParsedArguments arguments = parse_arguments(argc, argv);
+
+    if (arguments.parseResult == ParseResult::FAILURE)
+    {
+        return 0;
+    }
+
+    ConfigParser::get_instance()->load_config_file(arguments.cfgPath);
+
+    try
+    {
+        switch (arguments.nodeType)
+        {
+            case NodeType::PUBLISHER:
+            {
+                // Create an instance of DataWriter to send one sample per key
+                SequencesWriter dataWriter;
+                if (dataWriter.init(arguments.topicName))
+                {
+                    dataWriter.run(arguments.numOfSamples, arguments.numOfElements);
+                }
+                break;
+            }
+            case NodeType::SUBSCRIBER:
+            {
+                // Create an instance of DataReader to benchmark sequence access
+                SequencesReader dataReader;
+                if (dataReader.init(arguments.topicName))
+                {
+                    dataReader.run(arguments.numOfSamples, arguments.rounds);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Exception in run(): " << ex.what() << std::endl;
+        return 0;
+    }
+    return 0;
+}
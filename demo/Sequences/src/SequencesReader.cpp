@@ -0,0 +1,318 @@
+/**************************************************************
+* @file SequencesReader.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <iomanip>
+
+#include "SequencesReader.h"
+#include "ConfigParser.h"
+
+SequencesReader::SequencesReader()
+    : m_participant(nullptr),
+      m_topic(nullptr),
+      m_subscriber(nullptr),
+      m_reader(nullptr),
+      m_readerListener(new MyDataReaderListener())
+{
+}
+
+SequencesReader::~SequencesReader()
+{
+    delete m_readerListener;
+}
+
+bool SequencesReader::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_sub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_sequencesTopicType);
+    std::string topicTypeName = m_sequencesTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create subscriber
+    m_subscriber = ConfigParser::get_instance()->get_subscriber_from_json(
+        "subscriber_cfg", m_participant, nullptr, m_mask);
+    if (m_subscriber == nullptr)
+    {
+        return false;
+    }
+
+    // Create datareader
+    m_reader = ConfigParser::get_instance()->get_reader_from_json(
+        "reader_cfg", m_subscriber, m_topic, m_readerListener, m_mask);
+    if (m_reader == nullptr)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void SequencesReader::destroy()
+{
+    if (m_subscriber->delete_datareader(m_reader) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete reader error" << std::endl;
+    }
+    if (m_participant->delete_subscriber(m_subscriber) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete subscriber error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+void SequencesReader::print_result(const char* operation, const uint64_t& items, const char* unit, const int64_t& elapsedNs)
+{
+    std::cout << "[" << operation << "] " << unit << "s: " << items
+              << "; total: " << elapsedNs / 1000 << " us"
+              << "; per " << unit << ": " << std::fixed << std::setprecision(2)
+              << (items > 0 ? static_cast<double>(elapsedNs) / items : 0.0) << " ns" << std::endl;
+}
+
+bool SequencesReader::wait_for_samples(const uint32_t& numOfSamples)
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_readerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    std::cout << "Listeners have been matched successfully.\n\nWaiting for "
+              << numOfSamples << " samples..." << std::endl;
+
+    // Delivery is reliable and in order, so all samples are cached once the last key is known
+    Sequences last;
+    last.id(numOfSamples);
+    while ((m_readerListener->get_number_of_matched() > 0) &&
+        (m_reader->lookup_instance(&last) == greenstone::dds::HANDLE_NIL))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    if (m_reader->lookup_instance(&last) == greenstone::dds::HANDLE_NIL)
+    {
+        std::cout << "Writer left before all samples were received." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void SequencesReader::take_original_samples(std::vector<DDS::OriginalData>& samples)
+{
+    dds::core::SampleInfo info;
+    while (true)
+    {
+        DDS::OriginalData data;
+        if (m_reader->take_next_sample_original(data, info) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            break;
+        }
+        if (info.valid_data)
+        {
+            samples.push_back(std::move(data));
+        }
+    }
+}
+
+void SequencesReader::deserialize_samples(
+    std::vector<DDS::OriginalData>& samples,
+    std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples,
+    bool deserialize)
+{
+    greenstone::dds::DynamicTopicDataType dynamicTopicType(m_sequencesTopicType.get_dynamic_type());
+    dynamicSamples.clear();
+
+    for (DDS::OriginalData& data : samples)
+    {
+        greenstone::dds::DynamicData_Ptr dynamicData = greenstone::dds::DynamicDataFactory::get_instance()->create_data_w_flag(
+            m_sequencesTopicType.get_dynamic_type(), deserialize);
+        DdsCdr cdr;
+        if (dynamicTopicType.deserialize(cdr, data.getPayload(), dynamicData.get()))
+        {
+            dynamicSamples.push_back(dynamicData);
+        }
+    }
+}
+
+double SequencesReader::read_per_element(std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples)
+{
+    double sum = 0;
+
+    for (greenstone::dds::DynamicData_Ptr& dynamicData : dynamicSamples)
+    {
+        // Member values is the third member of Sequences
+        greenstone::dds::DynamicData_Ptr values = dynamicData->loan_value(2);
+        if (values == nullptr)
+        {
+            continue;
+        }
+
+        uint32_t count = values->get_item_count();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            float value = 0;
+            values->get_float32_value(value, i);
+            sum += value;
+        }
+
+        dynamicData->return_loaned_value(values);
+    }
+
+    return sum;
+}
+
+double SequencesReader::read_bulk(std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples, CdrView& view)
+{
+    int32_t valuesField = view.get_field(2);
+    std::vector<float> values;
+    double sum = 0;
+
+    for (greenstone::dds::DynamicData_Ptr& dynamicData : dynamicSamples)
+    {
+        if (!view.reset(dynamicData->get_raw_data()) ||
+            (view.get_float32_values(values, valuesField) != greenstone::dds::ReturnCode_t::RETCODE_OK))
+        {
+            continue;
+        }
+
+        const float* data = values.data();
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            sum += data[i];
+        }
+    }
+
+    return sum;
+}
+
+double SequencesReader::read_view(std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples, CdrView& view)
+{
+    int32_t valuesField = view.get_field(2);
+    std::vector<float> copied;
+    double sum = 0;
+
+    for (greenstone::dds::DynamicData_Ptr& dynamicData : dynamicSamples)
+    {
+        if (!view.reset(dynamicData->get_raw_data()))
+        {
+            continue;
+        }
+
+        const float* values = nullptr;
+        uint32_t count = 0;
+        greenstone::dds::ReturnCode_t ret = view.get_values_view(values, count, valuesField);
+        if (ret == greenstone::dds::ReturnCode_t::RETCODE_PRECONDITION_NOT_MET)
+        {
+            // Swapped or unaligned elements cannot be viewed in place, fall back to a copy
+            ret = view.get_float32_values(copied, valuesField);
+            values = copied.data();
+            count = static_cast<uint32_t>(copied.size());
+        }
+        if (ret != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            sum += values[i];
+        }
+    }
+
+    return sum;
+}
+
+void SequencesReader::run(const uint32_t& numOfSamples, const uint32_t& rounds)
+{
+    if (!wait_for_samples(numOfSamples))
+    {
+        destroy();
+        return;
+    }
+
+    std::vector<DDS::OriginalData> samples;
+    samples.reserve(numOfSamples);
+    take_original_samples(samples);
+
+    std::cout << "\nSequence access benchmark over " << samples.size() << " samples is ongoing..." << std::endl;
+
+    // Deserialize once into full DynamicData for per-element access, and once keeping the raw data for bulk access
+    std::vector<greenstone::dds::DynamicData_Ptr> fullSamples;
+    std::vector<greenstone::dds::DynamicData_Ptr> rawSamples;
+    auto start = std::chrono::steady_clock::now();
+    deserialize_samples(samples, fullSamples, true);
+    auto end = std::chrono::steady_clock::now();
+    print_result("deserialize into DynamicData", fullSamples.size(), "sample",
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+    start = std::chrono::steady_clock::now();
+    deserialize_samples(samples, rawSamples, false);
+    end = std::chrono::steady_clock::now();
+    print_result("keep raw data in DynamicData", rawSamples.size(), "sample",
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+    CdrView view(m_sequencesTopicType.get_dynamic_type());
+    uint32_t count = 0;
+    if (rawSamples.empty() || !view.reset(rawSamples.front()->get_raw_data()) ||
+        (view.get_item_count(count, view.get_field(2)) != greenstone::dds::ReturnCode_t::RETCODE_OK))
+    {
+        std::cout << "Locate sequence in raw data error." << std::endl;
+        destroy();
+        return;
+    }
+
+    int64_t perElementNs = 0;
+    int64_t bulkNs = 0;
+    int64_t viewNs = 0;
+    double perElementSum = 0;
+    double bulkSum = 0;
+    double viewSum = 0;
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        start = std::chrono::steady_clock::now();
+        perElementSum = read_per_element(fullSamples);
+        end = std::chrono::steady_clock::now();
+        perElementNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        start = std::chrono::steady_clock::now();
+        bulkSum = read_bulk(rawSamples, view);
+        end = std::chrono::steady_clock::now();
+        bulkNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        start = std::chrono::steady_clock::now();
+        viewSum = read_view(rawSamples, view);
+        end = std::chrono::steady_clock::now();
+        viewNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+
+    uint64_t total = static_cast<uint64_t>(count) * rawSamples.size() * rounds;
+    print_result("per-element get_float32_value", total, "element", perElementNs);
+    print_result("bulk get_float32_values", total, "element", bulkNs);
+    print_result("in-place get_values_view", total, "element", viewNs);
+    if ((bulkSum != perElementSum) || (viewSum != perElementSum))
+    {
+        std::cout << "Bulk access read " << bulkSum << " and " << viewSum << " instead of " << perElementSum << std::endl;
+    }
+
+    std::cout << "\nSequence access benchmark is over.\n" << std::endl;
+
+    destroy();
+}
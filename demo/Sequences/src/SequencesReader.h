@@ -0,0 +1,85 @@
+/**************************************************************
+* @file SequencesReader.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef SEQUENCES_READER_H
+#define SEQUENCES_READER_H
+
+#include <vector>
+
+#include "GeneralListeners.h"
+#include "CdrView.h"
+#include "SequencesTopicDataType.h"
+
+/**
+* @class SequencesReader
+* @brief A wrapper class subscribing Sequences topic and timing per-element against bulk access
+*        to the sequence of every sample.
+* @note
+*/
+
+class SequencesReader
+{
+public:
+
+    SequencesReader();
+
+    ~SequencesReader();
+
+    // Initialize DDS entities for subscribing Sequences topic
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Wait for all samples to arrive, then benchmark reading their sequences for a number of rounds
+    void run(const uint32_t& numOfSamples, const uint32_t& rounds);
+
+private:
+
+    // Wait for the writer to be matched and all samples to be in the reader cache
+    bool wait_for_samples(const uint32_t& numOfSamples);
+
+    // Take all samples in the reader cache without deserializing them
+    void take_original_samples(std::vector<DDS::OriginalData>& samples);
+
+    // Deserialize every sample into a DynamicData, fully or keeping the raw data only
+    void deserialize_samples(
+        std::vector<DDS::OriginalData>& samples,
+        std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples,
+        bool deserialize);
+
+    // Read every element with get_float32_value on the loaned sequence, return the sum of all elements
+    double read_per_element(std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples);
+
+    // Copy all elements at once with get_float32_values of a CdrView, return the sum of all elements
+    double read_bulk(std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples, CdrView& view);
+
+    // Read all elements in place with get_values_view of a CdrView, return the sum of all elements
+    double read_view(std::vector<greenstone::dds::DynamicData_Ptr>& dynamicSamples, CdrView& view);
+
+    // Print the result of one benchmarked operation
+    void print_result(const char* operation, const uint64_t& items, const char* unit, const int64_t& elapsedNs);
+
+    // Instance of SequencesTopicDataType
+    SequencesTopicDataType m_sequencesTopicType;
+
+    // DDS entities for DataReader
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Subscriber* m_subscriber;
+    greenstone::dds::DataReader* m_reader;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // A child class of GeneralReaderListener
+    class MyDataReaderListener : public GeneralReaderListener
+    {
+    public:
+        MyDataReaderListener() {}
+        ~MyDataReaderListener() {}
+    }* m_readerListener;
+};
+
+#endif  // SEQUENCES_READER_H
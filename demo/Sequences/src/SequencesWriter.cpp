@@ -0,0 +1,120 @@
+/**************************************************************
+* @file SequencesWriter.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include "SequencesWriter.h"
+#include "ConfigParser.h"
+
+SequencesWriter::SequencesWriter()
+    : m_participant(nullptr),
+      m_topic(nullptr),
+      m_publisher(nullptr),
+      m_writer(nullptr),
+      m_writerListener(new MyDataWriterListener())
+{
+}
+
+SequencesWriter::~SequencesWriter()
+{
+    delete m_writerListener;
+}
+
+bool SequencesWriter::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_pub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    m_participant->register_type(&m_sequencesTopicType);
+    std::string topicTypeName = m_sequencesTopicType.get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create publisher
+    m_publisher = ConfigParser::get_instance()->get_publisher_from_json(
+        "publisher_cfg", m_participant, nullptr, m_mask);
+    if (m_publisher == nullptr)
+    {
+        return false;
+    }
+
+    // Create datawriter
+    m_writer = ConfigParser::get_instance()->get_writer_from_json(
+        "writer_cfg", m_publisher, m_topic, m_writerListener, m_mask);
+    if (m_writer == nullptr)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void SequencesWriter::destroy()
+{
+    if (m_publisher->delete_datawriter(m_writer) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete writer error" << std::endl;
+    }
+    if (m_participant->delete_publisher(m_publisher) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete publisher error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+void SequencesWriter::run(const uint32_t& numOfSamples, const uint32_t& numOfElements)
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_writerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    std::cout << "Listeners have been matched successfully.\n\nSending " << numOfSamples
+              << " samples of " << numOfElements << " elements..." << std::endl;
+
+    m_sequences.values().resize(numOfElements);
+    for (uint32_t i = 0; i < numOfElements; i++)
+    {
+        m_sequences.values()[i] = static_cast<float>(i % 1000) * 0.5f;
+    }
+
+    uint32_t failed = 0;
+    for (uint32_t i = 1; i <= numOfSamples; i++)
+    {
+        // Keys start from 1, the handle of key 0 is identical to HANDLE_NIL
+        m_sequences.id(i);
+        m_sequences.index(i);
+
+        if (m_writer->write(&m_sequences, m_handle) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            ++failed;
+        }
+    }
+
+    std::cout << "All samples sent. Failed writes: " << failed
+              << "\n\nWaiting for the reader to finish the benchmark..." << std::endl;
+
+    // The reader benchmarks the samples in its own cache, keep the writer alive until it leaves
+    while (m_writerListener->get_number_of_matched() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    destroy();
+}
@@ -0,0 +1,59 @@
+/**************************************************************
+* @file SequencesWriter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef SEQUENCES_WRITER_H
+#define SEQUENCES_WRITER_H
+
+#include "GeneralListeners.h"
+#include "SequencesTopicDataType.h"
+
+/**
+* @class SequencesWriter
+* @brief A wrapper class publishing samples of Sequences topic, each holding a sequence of floats.
+* @note
+*/
+
+class SequencesWriter
+{
+public:
+
+    SequencesWriter();
+
+    ~SequencesWriter();
+
+    // Initialize DDS entities for publishing Sequences topic
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Publish one sample per key with the given number of elements and stay alive until the reader leaves
+    void run(const uint32_t& numOfSamples, const uint32_t& numOfElements);
+
+private:
+
+    // Instance of Sequences and SequencesTopicDataType
+    Sequences m_sequences;
+    SequencesTopicDataType m_sequencesTopicType;
+
+    // DDS entities for DataWriter
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Publisher* m_publisher;
+    greenstone::dds::DataWriter* m_writer;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+    greenstone::dds::InstanceHandle_t m_handle;
+
+    // A child class of GeneralWriterListener
+    class MyDataWriterListener : public GeneralWriterListener
+    {
+    public:
+        MyDataWriterListener() {}
+        ~MyDataWriterListener() {}
+    }* m_writerListener;
+};
+
+#endif  // SEQUENCES_WRITER_H
@@ -0,0 +1,493 @@
+/**************************************************************
+* @file Serialization.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "Serialization.h"
+#include "swiftdds/rtps/CdrSize.h"
+//#include <iostream>
+
+HelloWorld::HelloWorld()
+{
+	m_id = 0;
+	m_index = 0;
+
+}
+
+DdsCdr& HelloWorld::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_message);
+
+	return cdr;
+}
+uint32_t HelloWorld::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	HelloWorld* pData = static_cast<HelloWorld*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& HelloWorld::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_message);
+
+	return cdr;
+}
+bool HelloWorld::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	HelloWorld* pData = static_cast<HelloWorld*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool HelloWorld::is_key_defined()
+{
+	return true;
+
+}
+void HelloWorld::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void HelloWorld::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(unsigned short);
+	}
+
+}
+bool HelloWorld::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool HelloWorld::is_plain_types()
+{
+	return false;
+}
+uint32_t HelloWorld::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_message);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const HelloWorld::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void HelloWorld::set_key_val(HelloWorld const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+greenstone::dds::DynamicType_ptr HelloWorld::get_dynamic_type()
+{
+	greenstone::dds::DynamicTypeBuilder* type_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+	type_builder->add_member(0, "id", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint16_type());
+	type_builder->apply_annotation_to_member(0, *(greenstone::dds::AnnotationDescriptorFactory::get_instance()->create_annotation_descriptor_with_key()));
+	type_builder->add_member(1, "index", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->add_member(2, "message", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_string_type());
+	type_builder->set_name("HelloWorldTopicDataType");
+	return type_builder->build();
+
+}
+void HelloWorld::id(unsigned short const _id)
+{
+	m_id = _id;
+}
+unsigned short HelloWorld::id() const
+{
+	return m_id;
+}
+unsigned short& HelloWorld::id()
+{
+	return m_id;
+}
+
+void HelloWorld::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t HelloWorld::index() const
+{
+	return m_index;
+}
+uint32_t& HelloWorld::index()
+{
+	return m_index;
+}
+
+void HelloWorld::message(std::string const &_message)
+{
+	m_message = _message;
+}
+void HelloWorld::message(std::string &&_message)
+{
+	m_message = std::move(_message);
+}
+std::string const& HelloWorld::message() const
+{
+	return m_message;
+}
+std::string& HelloWorld::message()
+{
+	return m_message;
+}
+
+Latency::Latency()
+{
+	m_key = 0;
+	m_index = 0;
+	m_length = 0;
+
+}
+
+DdsCdr& Latency::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_key);
+	cdr.serialize(m_index);
+	cdr.serialize(m_length);
+	cdr.serialize(m_message);
+
+	return cdr;
+}
+uint32_t Latency::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	Latency* pData = static_cast<Latency*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& Latency::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_key);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_length);
+	cdr.deserialize(m_message);
+
+	return cdr;
+}
+bool Latency::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	Latency* pData = static_cast<Latency*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool Latency::is_key_defined()
+{
+	return false;
+
+}
+void Latency::serialize_key(DdsCdr &cdr) const
+{
+
+}
+void Latency::serialize_key(char **buf,unsigned int *len)
+{
+
+}
+bool Latency::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool Latency::is_plain_types()
+{
+	return false;
+}
+uint32_t Latency::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_key);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_length);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_message);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const Latency::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void Latency::set_key_val(Latency const* const _data) noexcept
+{
+
+}
+greenstone::dds::DynamicType_ptr Latency::get_dynamic_type()
+{
+	greenstone::dds::DynamicTypeBuilder* type_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+	type_builder->add_member(0, "key", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_int32_type());
+	type_builder->add_member(1, "index", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->add_member(2, "length", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	type_builder->add_member(3, "message", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_string_type());
+	type_builder->set_name("LatencyTopicDataType");
+	return type_builder->build();
+
+}
+void Latency::key(int32_t const _key)
+{
+	m_key = _key;
+}
+int32_t Latency::key() const
+{
+	return m_key;
+}
+int32_t& Latency::key()
+{
+	return m_key;
+}
+
+void Latency::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t Latency::index() const
+{
+	return m_index;
+}
+uint32_t& Latency::index()
+{
+	return m_index;
+}
+
+void Latency::length(uint32_t const _length)
+{
+	m_length = _length;
+}
+uint32_t Latency::length() const
+{
+	return m_length;
+}
+uint32_t& Latency::length()
+{
+	return m_length;
+}
+
+void Latency::message(std::string const &_message)
+{
+	m_message = _message;
+}
+void Latency::message(std::string &&_message)
+{
+	m_message = std::move(_message);
+}
+std::string const& Latency::message() const
+{
+	return m_message;
+}
+std::string& Latency::message()
+{
+	return m_message;
+}
+
+ZeroCopy::ZeroCopy()
+{
+	m_id = 0;
+	m_index = 0;
+
+}
+
+DdsCdr& ZeroCopy::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_message);
+
+	return cdr;
+}
+uint32_t ZeroCopy::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	ZeroCopy* pData = static_cast<ZeroCopy*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& ZeroCopy::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_message);
+
+	return cdr;
+}
+bool ZeroCopy::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	ZeroCopy* pData = static_cast<ZeroCopy*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool ZeroCopy::is_key_defined()
+{
+	return true;
+
+}
+void ZeroCopy::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void ZeroCopy::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(unsigned short);
+	}
+
+}
+bool ZeroCopy::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool ZeroCopy::is_plain_types()
+{
+	return true;
+}
+uint32_t ZeroCopy::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_message);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const ZeroCopy::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void ZeroCopy::set_key_val(ZeroCopy const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+greenstone::dds::DynamicType_ptr ZeroCopy::get_dynamic_type()
+{
+	greenstone::dds::DynamicTypeBuilder* type_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+	type_builder->add_member(0, "id", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint16_type());
+	type_builder->apply_annotation_to_member(0, *(greenstone::dds::AnnotationDescriptorFactory::get_instance()->create_annotation_descriptor_with_key()));
+	type_builder->add_member(1, "index", greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_uint32_type());
+	std::vector<uint32_t> message_bounds{61000};
+	greenstone::dds::DynamicType_ptr message_array_base_type = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_char8_type();
+	greenstone::dds::DynamicTypeBuilder* message_array_builder = greenstone::dds::DynamicTypeBuilderFactory::get_instance()->create_array_builder(message_array_base_type,message_bounds);
+	greenstone::dds::DynamicType_ptr message_array_type = message_array_builder->build();
+	type_builder->add_member(2, "message", message_array_type);
+	type_builder->set_name("ZeroCopyTopicDataType");
+	return type_builder->build();
+
+}
+void ZeroCopy::id(unsigned short const _id)
+{
+	m_id = _id;
+}
+unsigned short ZeroCopy::id() const
+{
+	return m_id;
+}
+unsigned short& ZeroCopy::id()
+{
+	return m_id;
+}
+
+void ZeroCopy::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t ZeroCopy::index() const
+{
+	return m_index;
+}
+uint32_t& ZeroCopy::index()
+{
+	return m_index;
+}
+
+void ZeroCopy::message(std::array<char,61000> const &_message)
+{
+	m_message = _message;
+}
+void ZeroCopy::message(std::array<char,61000> &&_message)
+{
+	m_message = std::move(_message);
+}
+std::array<char,61000> const& ZeroCopy::message() const
+{
+	return m_message;
+}
+std::array<char,61000>& ZeroCopy::message()
+{
+	return m_message;
+}
+
@@ -0,0 +1,510 @@
+/**************************************************************
+* @file SerializationTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "SerializationTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+HelloWorldTopicDataType::HelloWorldTopicDataType() : TopicDataType()
+{
+	set_name("HelloWorldTopicDataType");
+}
+HelloWorldTopicDataType::~HelloWorldTopicDataType()
+{
+
+}
+bool HelloWorldTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	HelloWorld* pData = static_cast<HelloWorld*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool HelloWorldTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	HelloWorld* pData = static_cast<HelloWorld*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool HelloWorldTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!HelloWorld::is_key_defined())
+	{
+		return false;
+	}
+	HelloWorld* pData = static_cast<HelloWorld*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool HelloWorldTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!HelloWorld::is_key_defined())
+	{
+		return false;
+	}
+	HelloWorld *data = new HelloWorld{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool HelloWorldTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)HelloWorld;
+
+	return true;
+}
+uint32_t HelloWorldTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	HelloWorld* pData = static_cast<HelloWorld*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool HelloWorldTopicDataType::is_with_key() noexcept
+{
+	return HelloWorld::is_key_defined();
+}
+bool HelloWorldTopicDataType::is_plain_types() noexcept
+{
+	return HelloWorld::is_plain_types();
+}
+void* HelloWorldTopicDataType::create_data_resource() noexcept
+{
+	HelloWorld* pData = new HelloWorld;
+
+	return pData;
+}
+void HelloWorldTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	HelloWorld* pData = reinterpret_cast<HelloWorld*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const HelloWorldTopicDataType::get_serialized_payload_header() noexcept
+{
+	return HelloWorld::get_serialized_payload_header();
+}
+
+void* const HelloWorldTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	HelloWorld* pData = reinterpret_cast<HelloWorld*>(data);
+	HelloWorld* newData = new HelloWorld{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const HelloWorldTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	HelloWorld *data = new HelloWorld{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void HelloWorldTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	HelloWorld* pData = reinterpret_cast<HelloWorld*>(data);
+	HelloWorld const* const keyData = reinterpret_cast<HelloWorld const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t HelloWorldTopicDataType::data_size_of() noexcept
+{
+	return sizeof(HelloWorld);
+}
+
+greenstone::dds::DynamicType_ptr const HelloWorldTopicDataType::get_dynamic_type() noexcept
+{
+	greenstone::dds::DynamicType_ptr ptr = HelloWorld::get_dynamic_type();
+
+	return ptr;
+}
+LatencyTopicDataType::LatencyTopicDataType() : TopicDataType()
+{
+	set_name("LatencyTopicDataType");
+}
+LatencyTopicDataType::~LatencyTopicDataType()
+{
+
+}
+bool LatencyTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	Latency* pData = static_cast<Latency*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool LatencyTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	Latency* pData = static_cast<Latency*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool LatencyTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Latency::is_key_defined())
+	{
+		return false;
+	}
+	Latency* pData = static_cast<Latency*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool LatencyTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!Latency::is_key_defined())
+	{
+		return false;
+	}
+	Latency *data = new Latency{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool LatencyTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)Latency;
+
+	return true;
+}
+uint32_t LatencyTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	Latency* pData = static_cast<Latency*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool LatencyTopicDataType::is_with_key() noexcept
+{
+	return Latency::is_key_defined();
+}
+bool LatencyTopicDataType::is_plain_types() noexcept
+{
+	return Latency::is_plain_types();
+}
+void* LatencyTopicDataType::create_data_resource() noexcept
+{
+	Latency* pData = new Latency;
+
+	return pData;
+}
+void LatencyTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	Latency* pData = reinterpret_cast<Latency*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const LatencyTopicDataType::get_serialized_payload_header() noexcept
+{
+	return Latency::get_serialized_payload_header();
+}
+
+void* const LatencyTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Latency* pData = reinterpret_cast<Latency*>(data);
+	Latency* newData = new Latency{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const LatencyTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	Latency *data = new Latency{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void LatencyTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	Latency* pData = reinterpret_cast<Latency*>(data);
+	Latency const* const keyData = reinterpret_cast<Latency const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t LatencyTopicDataType::data_size_of() noexcept
+{
+	return sizeof(Latency);
+}
+
+greenstone::dds::DynamicType_ptr const LatencyTopicDataType::get_dynamic_type() noexcept
+{
+	greenstone::dds::DynamicType_ptr ptr = Latency::get_dynamic_type();
+
+	return ptr;
+}
+ZeroCopyTopicDataType::ZeroCopyTopicDataType() : TopicDataType()
+{
+	set_name("ZeroCopyTopicDataType");
+}
+ZeroCopyTopicDataType::~ZeroCopyTopicDataType()
+{
+
+}
+bool ZeroCopyTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	ZeroCopy* pData = static_cast<ZeroCopy*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool ZeroCopyTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	ZeroCopy* pData = static_cast<ZeroCopy*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool ZeroCopyTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!ZeroCopy::is_key_defined())
+	{
+		return false;
+	}
+	ZeroCopy* pData = static_cast<ZeroCopy*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool ZeroCopyTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!ZeroCopy::is_key_defined())
+	{
+		return false;
+	}
+	ZeroCopy *data = new ZeroCopy{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool ZeroCopyTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)ZeroCopy;
+
+	return true;
+}
+uint32_t ZeroCopyTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	ZeroCopy* pData = static_cast<ZeroCopy*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool ZeroCopyTopicDataType::is_with_key() noexcept
+{
+	return ZeroCopy::is_key_defined();
+}
+bool ZeroCopyTopicDataType::is_plain_types() noexcept
+{
+	return ZeroCopy::is_plain_types();
+}
+void* ZeroCopyTopicDataType::create_data_resource() noexcept
+{
+	ZeroCopy* pData = new ZeroCopy;
+
+	return pData;
+}
+void ZeroCopyTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	ZeroCopy* pData = reinterpret_cast<ZeroCopy*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const ZeroCopyTopicDataType::get_serialized_payload_header() noexcept
+{
+	return ZeroCopy::get_serialized_payload_header();
+}
+
+void* const ZeroCopyTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	ZeroCopy* pData = reinterpret_cast<ZeroCopy*>(data);
+	ZeroCopy* newData = new ZeroCopy{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const ZeroCopyTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	ZeroCopy *data = new ZeroCopy{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void ZeroCopyTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	ZeroCopy* pData = reinterpret_cast<ZeroCopy*>(data);
+	ZeroCopy const* const keyData = reinterpret_cast<ZeroCopy const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t ZeroCopyTopicDataType::data_size_of() noexcept
+{
+	return sizeof(ZeroCopy);
+}
+
+greenstone::dds::DynamicType_ptr const ZeroCopyTopicDataType::get_dynamic_type() noexcept
+{
+	greenstone::dds::DynamicType_ptr ptr = ZeroCopy::get_dynamic_type();
+
+	return ptr;
+}
@@ -0,0 +1,61 @@
+/**************************************************************
+* @file AllocationCounter.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.h"
+
+namespace {
+    std::atomic<uint64_t> g_allocations {0};
+
+    void* counted_malloc(std::size_t size)
+    {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        void* ptr = std::malloc(size == 0 ? 1 : size);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+}
+
+uint64_t AllocationCounter::get_count()
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return counted_malloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
@@ -0,0 +1,27 @@
+/**************************************************************
+* @file AllocationCounter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+/**
+* @class AllocationCounter
+* @brief Counts the heap allocations of the whole process, including those made inside the DDS library,
+*        by replacing the global operator new.
+* @note Allocations through the aligned forms of operator new or through malloc are not counted, nor those
+*       through the nothrow forms with libstdc++ before GCC 9, which do not call the replaced operator new.
+*/
+
+class AllocationCounter
+{
+public:
+    // Get the number of allocations made so far
+    static uint64_t get_count();
+};
+
+#endif  // ALLOCATION_COUNTER_H
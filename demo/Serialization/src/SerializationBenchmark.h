@@ -0,0 +1,164 @@
+/**************************************************************
+* @file SerializationBenchmark.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef SERIALIZATION_BENCHMARK_H
+#define SERIALIZATION_BENCHMARK_H
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "SerializationTopicDataType.h"
+#include "DynamicDataPool.h"
+#include "AllocationCounter.h"
+
+/**
+* @class SerializationBenchmark
+* @brief A class timing the serialization of a datatype through its idlparser generated TopicDataType
+*        against the same datatype expressed as a DynamicType through DynamicTopicDataType.
+* @note Both paths go through the TopicDataType interface the DataWriter and DataReader use. The dynamic
+*       deserialization is timed into a new DynamicData per sample, into one reused DynamicData and into a
+*       DynamicData taken from a DynamicDataPool and released per sample. Heap allocations are counted too.
+*/
+
+class SerializationBenchmark
+{
+public:
+
+    explicit SerializationBenchmark(const uint32_t& iterations)
+        : m_iterations(iterations)
+    {
+    }
+
+    // Benchmark one datatype with a filled sample, return false if the two paths disagree
+    template<typename T>
+    bool run(const char* typeName, greenstone::dds::TopicDataType& topicType, T& sample)
+    {
+        greenstone::dds::DynamicType_ptr type = T::get_dynamic_type();
+        greenstone::dds::DynamicTopicDataType dynamicTopicType(type);
+
+        // The serializers write the CDR data only, the wire payload starts with the encapsulation header
+        // of plain CDR in the byte order of the host, little endian on all supported platforms
+        const uint8_t encapsulationHeader[4] {0x00, 0x01, 0x00, 0x00};
+        std::shared_ptr<greenstone::dds::SerializedPayload_t> staticPayload = serialize(topicType, &sample);
+        std::vector<uint8_t> wire(encapsulationHeader, encapsulationHeader + sizeof(encapsulationHeader));
+        wire.insert(wire.end(), staticPayload->value(), staticPayload->value() + staticPayload->length());
+        std::shared_ptr<greenstone::dds::SerializedPayload_t> wirePayload = std::make_shared<greenstone::dds::SerializedPayload_t>(false);
+        wirePayload->value(wire.data());
+        wirePayload->length(static_cast<uint32_t>(wire.size()));
+
+        // Fill a DynamicData from the same sample and check that both serializers agree
+        greenstone::dds::DynamicData_Ptr dynamicData = greenstone::dds::DynamicDataFactory::get_instance()->create_data(type);
+        if (!deserialize(dynamicTopicType, wirePayload, dynamicData.get()))
+        {
+            std::cout << "Deserialize " << typeName << " into DynamicData error." << std::endl;
+            return false;
+        }
+        std::shared_ptr<greenstone::dds::SerializedPayload_t> dynamicPayload = serialize(dynamicTopicType, dynamicData.get());
+        if ((dynamicPayload->length() != staticPayload->length()) ||
+            (memcmp(dynamicPayload->value(), staticPayload->value(), staticPayload->length()) != 0))
+        {
+            std::cout << "Serialized " << typeName << " differs between TopicDataType and DynamicTopicDataType." << std::endl;
+            return false;
+        }
+
+        std::cout << "\n" << typeName << " (" << staticPayload->length() << " bytes):" << std::endl;
+
+        T staticSample;
+        uint64_t allocations = AllocationCounter::get_count();
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_iterations; i++)
+        {
+            serialize(topicType, &sample);
+        }
+        print_result("static serialize", start, allocations);
+
+        allocations = AllocationCounter::get_count();
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_iterations; i++)
+        {
+            serialize(dynamicTopicType, dynamicData.get());
+        }
+        print_result("dynamic serialize", start, allocations);
+
+        allocations = AllocationCounter::get_count();
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_iterations; i++)
+        {
+            deserialize(topicType, wirePayload, &staticSample);
+        }
+        print_result("static deserialize", start, allocations);
+
+        allocations = AllocationCounter::get_count();
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_iterations; i++)
+        {
+            greenstone::dds::DynamicData_Ptr sampleData = greenstone::dds::DynamicDataFactory::get_instance()->create_data(type);
+            deserialize(dynamicTopicType, wirePayload, sampleData.get());
+        }
+        print_result("dynamic deserialize, new DynamicData", start, allocations);
+
+        allocations = AllocationCounter::get_count();
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_iterations; i++)
+        {
+            deserialize(dynamicTopicType, wirePayload, dynamicData.get());
+        }
+        print_result("dynamic deserialize, reused DynamicData", start, allocations);
+
+        DynamicDataPool pool(type);
+        allocations = AllocationCounter::get_count();
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < m_iterations; i++)
+        {
+            greenstone::dds::DynamicData_Ptr sampleData = pool.acquire();
+            deserialize(dynamicTopicType, wirePayload, sampleData.get());
+        }
+        print_result("dynamic deserialize, pooled DynamicData", start, allocations);
+
+        return true;
+    }
+
+private:
+
+    // Serialize a sample into a new payload
+    std::shared_ptr<greenstone::dds::SerializedPayload_t> serialize(greenstone::dds::TopicDataType& topicType, void* data)
+    {
+        DdsCdr cdr;
+        std::shared_ptr<greenstone::dds::SerializedPayload_t> payload = std::make_shared<greenstone::dds::SerializedPayload_t>();
+        topicType.serialize(cdr, data, payload);
+        return payload;
+    }
+
+    // Deserialize a wire payload into a sample
+    bool deserialize(
+        greenstone::dds::TopicDataType& topicType,
+        const std::shared_ptr<greenstone::dds::SerializedPayload_t>& payload,
+        void* data)
+    {
+        DdsCdr cdr;
+        return topicType.deserialize(cdr, payload, data);
+    }
+
+    // Print the cost and the heap allocations per sample of the iterations started at start
+    void print_result(const char* operation, const std::chrono::steady_clock::time_point& start, const uint64_t& allocations)
+    {
+        int64_t elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        uint64_t allocated = AllocationCounter::get_count() - allocations;
+        std::cout << "[" << operation << "] samples: " << m_iterations
+                  << "; total: " << elapsedNs / 1000 << " us"
+                  << "; per sample: " << (m_iterations > 0 ? elapsedNs / m_iterations : 0) << " ns"
+                  << "; allocations per sample: " << (m_iterations > 0 ? static_cast<double>(allocated) / m_iterations : 0.0)
+                  << std::endl;
+    }
+
+    // Number of iterations of each operation
+    uint32_t m_iterations;
+};
+
+#endif  // SERIALIZATION_BENCHMARK_H
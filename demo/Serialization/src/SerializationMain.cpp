@@ -0,0 +1,140 @@
+/**************************************************************
+* @file SerializationMain.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "SerializationBenchmark.h"
+
+enum ParseResult
+{
+    SUCCESS,
+    FAILURE
+};
+
+struct ParsedArguments
+{
+    uint32_t dataByte;
+    uint32_t iterations;
+    ParseResult parseResult;
+};
+
+inline ParsedArguments parse_arguments(int argc, char* argv[])
+{
+    ParsedArguments parsedArguments;
+    parsedArguments.dataByte = 32;
+    parsedArguments.iterations = 100000;
+    parsedArguments.parseResult = ParseResult::SUCCESS;
+
+    int argCount = 1;
+    bool printHelp = false;
+
+    while (argCount < argc)
+    {
+        if (strcmp(argv[argCount], "-h") == 0 || strcmp(argv[argCount], "--help") == 0)
+        {
+            std::cout << "List of arguments.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+        else if (strcmp(argv[argCount], "-b") == 0 || strcmp(argv[argCount], "--data-byte") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Data byte is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.dataByte = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else if (strcmp(argv[argCount], "-i") == 0 || strcmp(argv[argCount], "--iterations") == 0)
+        {
+            if (argCount + 1 == argc)
+            {
+                std::cout << "Number of iterations is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            else
+            {
+                parsedArguments.iterations = atoi(argv[argCount + 1]);
+            }
+            argCount += 2;
+        }
+        else
+        {
+            std::cout << "Wrong arguments. Please check optional arguments as below.\n" << std::endl;
+            printHelp = true;
+            parsedArguments.parseResult = ParseResult::FAILURE;
+            break;
+        }
+    }
+
+    if (printHelp)
+    {
+        std::cout << "Usage:\n"\
+                    "    -b, --data-byte        <int>         The size of the string message of HelloWorld and Latency (byte)\n"\
+                    "                                         Default: 32\n"
+                    "    -i, --iterations       <int>         Number of times each operation is timed\n"
+                    "                                         Default: 100000\n"
+        << std::endl;
+    }
+
+    return parsedArguments;
+}
+
+
+int main(int argc, char *argv[])
+{
+    ParsedArguments arguments = parse_arguments(argc, argv);
+
+    if (arguments.parseResult == ParseResult::FAILURE)
+    {
+        return 0;
+    }
+
+    try
+    {
+        SerializationBenchmark benchmark(arguments.iterations);
+        std::cout << "\nSerialization benchmark is ongoing..." << std::endl;
+
+        // The samples are filled like the HelloWorld, Latency and ZeroCopy demos fill theirs
+        HelloWorld helloWorld;
+        HelloWorldTopicDataType helloWorldTopicType;
+        helloWorld.id(1);
+        helloWorld.index(1);
+        helloWorld.message(std::string(arguments.dataByte, 'a'));
+        benchmark.run("HelloWorld", helloWorldTopicType, helloWorld);
+
+        Latency latency;
+        LatencyTopicDataType latencyTopicType;
+        latency.key(1);
+        latency.index(1);
+        latency.length(arguments.dataByte);
+        latency.message(std::string(arguments.dataByte, 'a'));
+        benchmark.run("Latency", latencyTopicType, latency);
+
+        ZeroCopy zeroCopy;
+        ZeroCopyTopicDataType zeroCopyTopicType;
+        zeroCopy.id(1);
+        zeroCopy.index(1);
+        zeroCopy.message().fill('a');
+        benchmark.run("ZeroCopy", zeroCopyTopicType, zeroCopy);
+
+        std::cout << "\nSerialization benchmark is over.\n" << std::endl;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Exception in run(): " << ex.what() << std::endl;
+        return 0;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**************************************************************
+* @file LossInjector.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+// Preloaded into a sender to drop a share of its UDP datagrams, as a lossy link would. The share is given in
+// percent by LOSS_PERCENT, and the drops are drawn from LOSS_SEED so that runs can be repeated. A dropped
+// datagram is reported as sent. Shared memory and TCP traffic are left alone.
+
+#include <dlfcn.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+
+namespace {
+    typedef ssize_t (*SendToFunc)(int, const void*, size_t, int, const struct sockaddr*, socklen_t);
+    typedef ssize_t (*SendFunc)(int, const void*, size_t, int);
+
+    // Drop threshold out of 1000000, read once
+    uint32_t get_threshold()
+    {
+        static const uint32_t threshold = []() {
+            const char* percent = std::getenv("LOSS_PERCENT");
+            return (percent == nullptr) ? 0U : static_cast<uint32_t>(std::atof(percent) * 10000);
+        }();
+        return threshold;
+    }
+
+    // Draw whether the next datagram of fd is dropped
+    bool drop(int fd)
+    {
+        static std::atomic<uint64_t> state([]() {
+            const char* seed = std::getenv("LOSS_SEED");
+            return (seed == nullptr) ? 1ULL : std::strtoull(seed, nullptr, 10) | 1ULL;
+        }());
+        if (get_threshold() == 0)
+        {
+            return false;
+        }
+        int type = 0;
+        socklen_t length = sizeof(type);
+        if ((getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &length) != 0) || (type != SOCK_DGRAM))
+        {
+            return false;
+        }
+        // xorshift64, shared by the sending threads
+        uint64_t x = state.load(std::memory_order_relaxed);
+        uint64_t next;
+        do
+        {
+            next = x;
+            next ^= next << 13;
+            next ^= next >> 7;
+            next ^= next << 17;
+        } while (!state.compare_exchange_weak(x, next, std::memory_order_relaxed));
+        return (next % 1000000) < get_threshold();
+    }
+}
+
+extern "C" ssize_t sendto(int fd, const void* buf, size_t len, int flags, const struct sockaddr* addr, socklen_t addrLen)
+{
+    static SendToFunc realSendTo = reinterpret_cast<SendToFunc>(dlsym(RTLD_NEXT, "sendto"));
+    if (drop(fd))
+    {
+        return static_cast<ssize_t>(len);
+    }
+    return realSendTo(fd, buf, len, flags, addr, addrLen);
+}
+
+extern "C" ssize_t send(int fd, const void* buf, size_t len, int flags)
+{
+    static SendFunc realSend = reinterpret_cast<SendFunc>(dlsym(RTLD_NEXT, "send"));
+    if (drop(fd))
+    {
+        return static_cast<ssize_t>(len);
+    }
+    return realSend(fd, buf, len, flags);
+}
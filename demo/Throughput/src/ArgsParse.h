@@ -38,6 +38,12 @@ struct ParsedArguments
     std::string topicName;
     bool verbose;
     bool printDetails;
+    std::string allocator;
+    double rate;
+    uint32_t burst;
+    uint32_t ackProbe;
+    uint32_t workTime;
+    uint32_t maxLag;
     ParseResult parseResult;
 };
 
@@ -111,6 +117,12 @@ ParsedArguments parse_arguments(int argc, char* argv[])
     parsedArguments.topicName = "Throughput";
     parsedArguments.verbose = false;
     parsedArguments.printDetails = false;
+    parsedArguments.allocator = "malloc";
+    parsedArguments.rate = 0;
+    parsedArguments.burst = 0;
+    parsedArguments.ackProbe = 0;
+    parsedArguments.workTime = 0;
+    parsedArguments.maxLag = 0;
     parsedArguments.parseResult = ParseResult::SUCCESS;
 
     int argCount = 1;
@@ -219,6 +231,91 @@ ParsedArguments parse_arguments(int argc, char* argv[])
             parsedArguments.printDetails = true;
             argCount += 1;
 
+        } 
+        else if (strcmp(argv[argCount], "-r") == 0 || strcmp(argv[argCount], "--rate") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "rate is missed. Default value (0) will be used." << std::endl;
+            } 
+            else 
+            {
+                parsedArguments.rate = atof(argv[argCount + 1]);
+            }
+            argCount += 2;
+
+        } 
+        else if (strcmp(argv[argCount], "-b") == 0 || strcmp(argv[argCount], "--burst") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "burst is missed. Default value (0) will be used." << std::endl;
+            } 
+            else 
+            {
+                parsedArguments.burst = convert_to_number(argv[argCount + 1]);
+            }
+            argCount += 2;
+
+        } 
+        else if (strcmp(argv[argCount], "-k") == 0 || strcmp(argv[argCount], "--ack-probe") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "ack-probe is missed. Default value (0) will be used." << std::endl;
+            } 
+            else 
+            {
+                parsedArguments.ackProbe = convert_to_number(argv[argCount + 1]);
+            }
+            argCount += 2;
+
+        } 
+        else if (strcmp(argv[argCount], "-w") == 0 || strcmp(argv[argCount], "--work-time") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "work-time is missed. Default value (0) will be used." << std::endl;
+            } 
+            else 
+            {
+                parsedArguments.workTime = convert_to_number(argv[argCount + 1]);
+            }
+            argCount += 2;
+
+        } 
+        else if (strcmp(argv[argCount], "-l") == 0 || strcmp(argv[argCount], "--max-lag") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "max-lag is missed. Default value (0) will be used." << std::endl;
+            } 
+            else 
+            {
+                parsedArguments.maxLag = convert_to_number(argv[argCount + 1]);
+            }
+            argCount += 2;
+
+        } 
+        else if (strcmp(argv[argCount], "-a") == 0 || strcmp(argv[argCount], "--allocator") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "allocator is missed. Default value (malloc) will be used." << std::endl;
+            } 
+            else if (strcmp(argv[argCount + 1], "malloc") == 0 || strcmp(argv[argCount + 1], "slab") == 0) 
+            {
+                parsedArguments.allocator = argv[argCount + 1];
+            } 
+            else 
+            {
+                std::cout << "Wrong allocator. Please check optional arguments as below.\n" << std::endl;
+                printHelp = true;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            argCount += 2;
+
         } 
         else 
         {
@@ -246,7 +343,20 @@ ParsedArguments parse_arguments(int argc, char* argv[])
                     "    -v, --verbose          <bool>        Verbose mode\n"
                     "                                         Default: false\n"
                     "    -d, --details          <bool>        Print details for whole record of testing results\n"
-                    "                                         Default: false"
+                    "                                         Default: false\n"
+                    "    -a, --allocator        <string>      Allocator of the heap, slab requires USE_USER_ALLOCATOR\n"
+                    "                                         Values: malloc, slab\n"
+                    "                                         Default: malloc\n"
+                    "    -r, --rate             <double>      Rate the publisher paces the samples to (unit: Mbps)\n"
+                    "                                         Default: 0, not paced\n"
+                    "    -b, --burst            <int>         Bytes the publisher may send at once when paced\n"
+                    "                                         Default: 0, 1 ms at the rate or one sample\n"
+                    "    -k, --ack-probe        <int>         Samples between waits for the acknowledgement of all readers\n"
+                    "                                         Default: 0, not probed\n"
+                    "    -w, --work-time        <int>         Time the receiver spends on every sample (unit: us)\n"
+                    "                                         Default: 0\n"
+                    "    -l, --max-lag          <int>         Samples the receiver may lag behind before dropping the oldest\n"
+                    "                                         Default: 0, not bounded"
 		<< std::endl;
     }
 
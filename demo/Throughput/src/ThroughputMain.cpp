@@ -8,6 +8,7 @@
 #include "ThroughputSub.h"
 #include "ConfigParser.h"
 #include "ArgsParse.h"
+#include "SlabAllocator.h"
 
 int main(int argc, char* argv[])
 {
@@ -18,6 +19,13 @@ int main(int argc, char* argv[])
         return 0;
     }
 
+    // The allocator must be installed before any DDS entity is created, and outlive all of them
+    static SlabAllocator slabAllocator;
+    if ((arguments.allocator == "slab") && !UserAllocator::install(&slabAllocator))
+    {
+        return 0;
+    }
+
     try 
     {
         ConfigParser::get_instance()->load_config_file(arguments.cfgPath);
@@ -46,6 +54,8 @@ int main(int argc, char* argv[])
             case NodeType::PUBLISHER:
             {
                 ThroughputPub dataWriter(arguments.verbose, arguments.topicName);
+                dataWriter.set_rate(arguments.rate, arguments.burst);
+                dataWriter.set_ack_probe(arguments.ackProbe);
                 
                 dataWriter.test(payloads, arguments.sleepTime);
                 
@@ -54,6 +64,10 @@ int main(int argc, char* argv[])
             case NodeType::SUBSCRIBER:
             {
                 ThroughputSub dataReader(arguments.verbose, arguments.topicName);
+                if (!dataReader.set_slow_reader(arguments.workTime, arguments.maxLag))
+                {
+                    break;
+                }
 
                 dataReader.test();
 
@@ -66,5 +80,10 @@ int main(int argc, char* argv[])
         std::cerr << "Exception in run(): " << ex.what() << std::endl;
         return 0;
     }
+
+    if (UserAllocator::get_installed() == &slabAllocator)
+    {
+        std::cout << "Slab allocator reserved " << slabAllocator.get_reserved_bytes() / (1 << 20) << " MB" << std::endl;
+    }
     return 0;
 }
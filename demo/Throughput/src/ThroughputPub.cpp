@@ -6,6 +6,8 @@
 
 #include "ThroughputPub.h"
 
+#include <algorithm>
+
 ThroughputPub::PubReaderListener::PubReaderListener(ThroughputPub* up) :
     m_up(up)
 {
@@ -58,7 +60,10 @@ ThroughputPub::ThroughputPub(bool verbose, std::string& topicName) :
     m_subscriber(nullptr),
     m_reader(nullptr),
     m_writerListener(new GeneralWriterListener()),
-    m_readerListener(new PubReaderListener(this))
+    m_readerListener(new PubReaderListener(this)),
+    m_rate(0),
+    m_burst(0),
+    m_ackProbe(0)
 {
     //CREATE THE PARTICIPANT
     m_participant = ConfigParser::get_instance()->get_participant_from_json(
@@ -95,11 +100,13 @@ ThroughputPub::ThroughputPub(bool verbose, std::string& topicName) :
 
 ThroughputPub::~ThroughputPub()
 {
+    m_publisher->delete_datawriter(m_writer);
+    m_subscriber->delete_datareader(m_reader);
+
+    // The listeners may be called until their entities are deleted
     delete m_writerListener;
     delete m_readerListener;
 
-    m_publisher->delete_datawriter(m_writer);
-    m_subscriber->delete_datareader(m_reader);
     m_participant->delete_publisher(m_publisher);
     m_participant->delete_subscriber(m_subscriber);
     m_participant->delete_topic(m_topic);
@@ -121,6 +128,17 @@ void ThroughputPub::publish()
     }
 }
 
+void ThroughputPub::set_rate(double rate, uint32_t burst)
+{
+    m_rate = rate;
+    m_burst = burst;
+}
+
+void ThroughputPub::set_ack_probe(uint32_t count)
+{
+    m_ackProbe = count;
+}
+
 void ThroughputPub::test(const std::vector<std::pair<uint32_t, uint32_t>>& payloads, int sleepTime)
 {
     std::cout << "Waiting for listeners to be matched..." << std::endl;
@@ -161,17 +179,55 @@ void ThroughputPub::test(const std::vector<std::pair<uint32_t, uint32_t>>& paylo
         //START SENDING NORMAL SAMPLES
         m_msg.message().resize(m_payloadSize - 12, 'a');
 
+        // The bucket starts full for every payload, by default it holds 1 ms at the rate or one sample
+        uint64_t rateBytes = static_cast<uint64_t>(m_rate * 1000000 / 8);
+        uint64_t burst = (m_burst > 0) ? m_burst : std::max<uint64_t>(rateBytes / 1000, m_payloadSize);
+        TokenBucket pacer(rateBytes, burst);
+        int64_t lowestFill = static_cast<int64_t>(burst);
+        WriterAckProbe ackProbe(m_writer);
+        int32_t writerTimeouts = ackProbe.get_writer_timeout_count();
+
         for (uint32_t i = 2; i <= m_payloadCount; ++i)
         {
             m_msg.index(i);
+            if (m_rate > 0)
+            {
+                pacer.acquire(m_payloadSize);
+                lowestFill = std::min(lowestFill, pacer.get_fill_level());
+            }
             publish();
 
+            if (m_ackProbe > 0)
+            {
+                ackProbe.on_written(m_payloadSize);
+                if ((i % m_ackProbe) == 0)
+                {
+                    ackProbe.probe(greenstone::dds::Duration_t(static_cast<uint64_t>(1000)));
+                }
+            }
+
             if (sleepTime >= 1)
             {
                 std::this_thread::sleep_for(std::chrono::milliseconds(sleepTime));
             }
         }
 
+        if (m_rate > 0)
+        {
+            std::cout << "Paced to " << m_rate << " Mbps with a burst of " << burst
+                      << " B, lowest fill level of the bucket: " << lowestFill << " B" << std::endl;
+        }
+
+        if (m_ackProbe > 0)
+        {
+            std::cout << "Acknowledged in " << ackProbe.get_ack_time() << " us (variation " << ackProbe.get_ack_time_variation()
+                      << " us, min " << ackProbe.get_min_ack_time() << " us, max " << ackProbe.get_max_ack_time()
+                      << " us), delivered " << ackProbe.get_delivered_rate() * 8 / 1000000 << " Mbps, largest window "
+                      << ackProbe.get_max_outstanding_bytes() << " B, " << ackProbe.get_number_of_timeouts() << " of "
+                      << ackProbe.get_number_of_probes() << " probes timed out, "
+                      << ackProbe.get_writer_timeout_count() - writerTimeouts << " samples dropped on timeout" << std::endl;
+        }
+
         //SEND THE LAST SAMPLE
         m_msg.index(0);
         publish();
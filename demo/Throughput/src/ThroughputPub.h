@@ -13,6 +13,8 @@
 #include "GeneralListeners.h"
 #include "swiftdds/dcps/SwiftDdsExport.h"
 #include "ThroughputPubBase.h"
+#include "TokenBucket.h"
+#include "WriterAckProbe.h"
 
 /**
 * @class ThroughputPub
@@ -34,6 +36,12 @@ public:
     // the main function of test throughput
 	void test(const std::vector<std::pair<uint32_t, uint32_t>>& payloads, int sleepTime);
 
+    // pace the samples to rate in Mbps with a token bucket of burst bytes, 0 for not paced
+    void set_rate(double rate, uint32_t burst);
+
+    // wait for the acknowledgement of all readers every count samples and print the estimates, 0 for no probe
+    void set_ack_probe(uint32_t count);
+
 private:
 
     // a class of readerlistener 
@@ -66,6 +74,9 @@ private:
 	greenstone::dds::InstanceHandle_t m_handle;
 	GeneralWriterListener* m_writerListener;
     PubReaderListener* m_readerListener;
+    double m_rate;
+    uint32_t m_burst;
+    uint32_t m_ackProbe;
 };
 
 #endif  // THROUGHPUT_PUB_H
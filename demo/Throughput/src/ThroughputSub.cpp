@@ -6,9 +6,8 @@
 
 #include "ThroughputSub.h"
 
-ThroughputSub::SubReaderListener::SubReaderListener(ThroughputSub* up, greenstone::dds::DataWriter* writer) :
-    m_up(up),
-    m_writerEcho(writer)
+ThroughputSub::SubReaderListener::SubReaderListener(ThroughputSub* up) :
+    m_up(up)
 {
 }
 
@@ -18,53 +17,75 @@ ThroughputSub::SubReaderListener::~SubReaderListener()
 
 void ThroughputSub::SubReaderListener::on_data_available(greenstone::dds::DataReader* reader) noexcept
 {
+    // The samples are taken by the lag guard when the lag is bounded
+    if (m_up->m_maxLag > 0)
+    {
+        return;
+    }
+
     if (reader->take_next_sample(&m_msg, m_info) == greenstone::dds::ReturnCode_t::RETCODE_OK)
     {
-        ++m_up->m_sampleCnt;
-        if (m_up->m_verbose)
+        m_up->process(m_msg, m_handle);
+    }
+}
+
+void ThroughputSub::process(Throughput& msg, greenstone::dds::InstanceHandle_t& handle)
+{
+    ++m_sampleCnt;
+    if (m_verbose)
+    {
+        std::cout << "Message with index of " << msg.index() << " received.  " << m_sampleCnt << std::endl;
+    }
+    
+    if (msg.index() == 1)
+    {
+        m_payloadCount = std::stoi(msg.message());
+
+        msg.message("");
+        while (m_writer->write(&msg, handle) != greenstone::dds::ReturnCode_t::RETCODE_OK)
         {
-            std::cout << "Message with index of " << m_msg.index() << " received.  " << m_up->m_sampleCnt << std::endl;
+            std::cout << "Resending START command..." << std::endl;
         }
-        
-        if (m_msg.index() == 1)
-        {
-            m_up->m_payloadCount = std::stoi(m_msg.message());
-
-            m_msg.message("");
-            while (m_writerEcho->write(&m_msg, m_handle) != greenstone::dds::ReturnCode_t::RETCODE_OK)
-            {
-                std::cout << "Resending START command..." << std::endl;
-            }
 
-            if (m_up->m_verbose)
-            {
-                std::cout << "START command sent." << std::endl;
-            }
+        if (m_verbose)
+        {
+            std::cout << "START command sent." << std::endl;
         }
-        else if (m_msg.index() == 0)
+    }
+    else if (msg.index() == 0)
+    {
+        m_t2 = std::chrono::steady_clock::now();
+        m_deltaT = std::chrono::duration_cast<std::chrono::microseconds>(m_t2 - m_t1).count();
+        m_throughput = (m_sampleCnt - 2) * ( sizeof(msg.key()) + sizeof(msg.index()) + sizeof(msg.length()) + msg.message().size() ) * 8 * 1000000 / m_deltaT / 1000.0 /1000.0;
+        m_payloadSize = msg.length();
+        print_throughput_result();
+        if (m_lagGuard != nullptr)
         {
-            m_up->m_t2 = std::chrono::steady_clock::now();
-            m_up->m_deltaT = std::chrono::duration_cast<std::chrono::microseconds>(m_up->m_t2 - m_up->m_t1).count();
-            m_up->m_throughput = (m_up->m_sampleCnt - 2) * ( sizeof(m_msg.key()) + sizeof(m_msg.index()) + sizeof(m_msg.length()) + m_msg.message().size() ) * 8 * 1000000 / m_up->m_deltaT / 1000.0 /1000.0;
-            m_up->m_payloadSize = m_msg.length();
-            m_up->print_throughput_result();
+            std::cout << "Samples dropped by the lag guard: " << m_lagGuard->get_number_of_dropped() << std::endl;
+        }
 
-            m_up->m_sampleCnt = 0;
+        m_sampleCnt = 0;
 
-            m_msg.message("");
-            while (m_writerEcho->write(&m_msg, m_handle) != greenstone::dds::ReturnCode_t::RETCODE_OK)
-            {
-                std::cout << "Resending notification message..." << std::endl;
-            }
+        msg.message("");
+        while (m_writer->write(&msg, handle) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            std::cout << "Resending notification message..." << std::endl;
+        }
 
-            if (m_up->m_verbose)
-            {
-                std::cout << "Notification message sent." << std::endl;
-            }
+        if (m_verbose)
+        {
+            std::cout << "Notification message sent." << std::endl;
         }
-        else if (m_msg.index() == 2)
+    }
+    else
+    {
+        if (msg.index() == 2)
         {
-            m_up->m_t1 = std::chrono::steady_clock::now();
+            m_t1 = std::chrono::steady_clock::now();
+        }
+        if (m_workTime > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(m_workTime));
         }
     }
 }
@@ -78,7 +99,10 @@ ThroughputSub::ThroughputSub(bool verbose, std::string& topicName) :
     m_writer(nullptr),
     m_subscriber(nullptr),
     m_reader(nullptr),
-    m_writerListener(new GeneralWriterListener())
+    m_writerListener(new GeneralWriterListener()),
+    m_workTime(0),
+    m_maxLag(0),
+    m_lagGuard(nullptr)
 {
     //CREATE THE PARTICIPANT
     m_participant = ConfigParser::get_instance()->get_participant_from_json(
@@ -108,18 +132,22 @@ ThroughputSub::ThroughputSub(bool verbose, std::string& topicName) :
         "subscriber_cfg", m_participant, nullptr, m_mask);
 
     //CREATE THE READER
-    m_readerListener = new SubReaderListener(this, m_writer);
+    m_readerListener = new SubReaderListener(this);
     m_reader = ConfigParser::get_instance()->get_reader_from_json(
         "reader_cfg", m_subscriber, m_topic, m_readerListener, m_mask);
 }
 
 ThroughputSub::~ThroughputSub()
 {
-    delete m_writerListener;
-    delete m_readerListener;
+    delete m_lagGuard;
 
     m_publisher->delete_datawriter(m_writer);
     m_subscriber->delete_datareader(m_reader);
+
+    // The listeners may be called until their entities are deleted
+    delete m_writerListener;
+    delete m_readerListener;
+
     m_participant->delete_publisher(m_publisher);
     m_participant->delete_subscriber(m_subscriber);
     m_participant->delete_topic(m_topic);
@@ -128,6 +156,29 @@ ThroughputSub::~ThroughputSub()
     greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant);
 }
 
+bool ThroughputSub::set_slow_reader(uint32_t workTime, uint32_t maxLag)
+{
+    m_workTime = workTime;
+    m_maxLag = maxLag;
+    if ((maxLag > 0) && (m_lagGuard == nullptr))
+    {
+        m_lagGuard = new ReaderLagGuard(m_reader, maxLag, ReaderLagGuard::LagPolicy::DROP_OLDEST,
+            [](const ReaderLagGuard::LagStatus& status)
+            {
+                if (status.lagging)
+                {
+                    std::cout << "Reader lagging " << status.backlog << " samples behind, dropping the oldest" << std::endl;
+                }
+                else
+                {
+                    std::cout << "Reader caught up after dropping " << status.droppedChange << " samples" << std::endl;
+                }
+            });
+        return m_lagGuard->start();
+    }
+    return true;
+}
+
 void ThroughputSub::test()
 {
     std::cout << "Waiting for listeners to be matched..." << std::endl;
@@ -139,6 +190,25 @@ void ThroughputSub::test()
 
     std::cout << "Listeners have been matched successfully.\n\nThroughput test is ongoing..." << std::endl; 
 
+    if (m_maxLag > 0)
+    {
+        // Process the samples the lag guard keeps taking from the reader, until the writer leaves and all are processed
+        Throughput msg;
+        greenstone::dds::InstanceHandle_t handle;
+        DDS::OriginalData data;
+        greenstone::dds::SampleInfo info;
+        DdsCdr cdr;
+        while (!(m_writerListener->get_number_of_matched() == 0 && m_readerListener->get_number_of_matched() == 0) ||
+               (m_lagGuard->get_backlog() > 0))
+        {
+            if (m_lagGuard->take(data, info, std::chrono::milliseconds(100)) && info.valid_data &&
+                m_msgTopicType.deserialize(cdr, data.getPayload(), &msg))
+            {
+                process(msg, handle);
+            }
+        }
+    }
+
     while (!(m_writerListener->get_number_of_matched() == 0 && m_readerListener->get_number_of_matched() == 0))
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1000));
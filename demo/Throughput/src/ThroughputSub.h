@@ -13,6 +13,7 @@
 #include "GeneralListeners.h"
 #include "swiftdds/dcps/SwiftDdsExport.h"
 #include "ThroughputSubBase.h"
+#include "ReaderLagGuard.h"
 
 /**
 * @class ThroughputSub
@@ -31,19 +32,25 @@ public:
     // wait match and end with unmatch
 	void test();
 
+    // spend workTime us on every sample, and drop the oldest samples once maxLag samples are not processed, 0 for no bound,
+    // return false if the lag guard cannot be started
+    bool set_slow_reader(uint32_t workTime, uint32_t maxLag);
+
 private:
+    // process a sample received, echo the control samples
+    void process(Throughput& msg, greenstone::dds::InstanceHandle_t& handle);
+
     // a class of readerlistener
 	class SubReaderListener : public GeneralReaderListener
 	{
 	public:
-		SubReaderListener(ThroughputSub* up, greenstone::dds::DataWriter* writer);
+		explicit SubReaderListener(ThroughputSub* up);
 		~SubReaderListener();
 
         // receive data and calculate throughput
 		void on_data_available(greenstone::dds::DataReader* reader) noexcept override;
 	private:
 		ThroughputSub* m_up;
-		greenstone::dds::DataWriter* m_writerEcho;
 		Throughput m_msg;
         greenstone::dds::SampleInfo m_info;
 		greenstone::dds::InstanceHandle_t m_handle;
@@ -62,6 +69,9 @@ private:
 	greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
 	GeneralWriterListener* m_writerListener;
     SubReaderListener* m_readerListener;
+    uint32_t m_workTime;
+    uint32_t m_maxLag;
+    ReaderLagGuard* m_lagGuard;
 };
 
 #endif // THROUGHPUT_SUB_H
@@ -0,0 +1,181 @@
+/**************************************************************
+* @file LoanedPointCloud.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "LoanedPointCloud.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+LoanedPointCloud::LoanedPointCloud()
+{
+	m_id = 0;
+	m_index = 0;
+	m_stamp = 0;
+	m_size = sizeof(LoanedPointCloud);
+
+}
+
+DdsCdr& LoanedPointCloud::serialize(DdsCdr &cdr) const
+{
+	// Same bytes as PointCloud: the string with its terminator and the sequence, each after its length
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_stamp);
+	cdr.serialize(m_frame_id.size() + 1U);
+	cdr.serialize(m_frame_id.c_str(), m_frame_id.size() + 1U);
+	cdr.serialize(m_points.size());
+	if (!m_points.empty())
+	{
+		cdr.serialize(m_points.data(), m_points.size());
+	}
+
+	return cdr;
+}
+
+DdsCdr& LoanedPointCloud::deserialize(DdsCdr &cdr)
+{
+	// The string and the sequence do not fit in the fixed part, they are left empty
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_stamp);
+	m_size = sizeof(LoanedPointCloud);
+	m_frame_id.reset(nullptr, 0U);
+	m_points.reset(nullptr, 0U);
+
+	return cdr;
+}
+
+bool LoanedPointCloud::is_key_defined()
+{
+	return true;
+
+}
+void LoanedPointCloud::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void LoanedPointCloud::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(unsigned short);
+	}
+
+}
+bool LoanedPointCloud::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool LoanedPointCloud::is_plain_types()
+{
+	return true;
+}
+uint32_t LoanedPointCloud::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_stamp);
+	maxSize = greenstone::dds::CdrUtil::alignment_bytes(maxSize, 4U) + m_frame_id.size() + 1U;
+	maxSize = greenstone::dds::CdrUtil::alignment_bytes(maxSize, 4U) + m_points.size() * sizeof(float);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const LoanedPointCloud::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void LoanedPointCloud::set_key_val(LoanedPointCloud const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+uint64_t LoanedPointCloud::get_loan_size(uint32_t const frameIdLength, uint32_t const count)
+{
+	uint64_t size = LoanArena::extend(sizeof(LoanedPointCloud), static_cast<uint64_t>(frameIdLength) + 1U);
+	return LoanArena::extend(size, static_cast<uint64_t>(count) * sizeof(float), alignof(float));
+}
+bool LoanedPointCloud::is_valid(uint32_t const maxSize) const
+{
+	return (m_size >= sizeof(LoanedPointCloud)) && (m_size <= maxSize) &&
+		m_frame_id.is_within(this, m_size) && m_points.is_within(this, m_size);
+}
+void LoanedPointCloud::id(unsigned short const _id)
+{
+	m_id = _id;
+}
+unsigned short LoanedPointCloud::id() const
+{
+	return m_id;
+}
+unsigned short& LoanedPointCloud::id()
+{
+	return m_id;
+}
+
+void LoanedPointCloud::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t LoanedPointCloud::index() const
+{
+	return m_index;
+}
+uint32_t& LoanedPointCloud::index()
+{
+	return m_index;
+}
+
+void LoanedPointCloud::stamp(uint64_t const _stamp)
+{
+	m_stamp = _stamp;
+}
+uint64_t LoanedPointCloud::stamp() const
+{
+	return m_stamp;
+}
+uint64_t& LoanedPointCloud::stamp()
+{
+	return m_stamp;
+}
+
+void LoanedPointCloud::size(uint32_t const _size)
+{
+	m_size = _size;
+}
+uint32_t LoanedPointCloud::size() const
+{
+	return m_size;
+}
+
+OffsetString const& LoanedPointCloud::frame_id() const
+{
+	return m_frame_id;
+}
+OffsetString& LoanedPointCloud::frame_id()
+{
+	return m_frame_id;
+}
+
+OffsetVector<float> const& LoanedPointCloud::points() const
+{
+	return m_points;
+}
+OffsetVector<float>& LoanedPointCloud::points()
+{
+	return m_points;
+}
@@ -0,0 +1,97 @@
+/**************************************************************
+* @file LoanedPointCloud.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#ifndef LOANEDPOINTCLOUD_H
+#define LOANEDPOINTCLOUD_H
+
+#include <stdint.h>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+#include "LoanArena.h"
+
+
+
+
+/**
+* @class LoanedPointCloud
+* @brief A class as the datatype of PointCloud written through loans, with its string and sequence held in the
+*        bytes of the loan as OffsetString and OffsetVector.
+* @note The class is the fixed part of a sample of size() bytes laid out with LoanArena. It reports itself as a
+*       plain type because loan_sample only accepts plain types, and the loan holds no pointer, but sizeof does
+*       not cover its containers. Only shared memory with enableZeroCopy carries all the bytes of the loan, so
+*       the type must be written through loans to readers preferring SHM. Other transports serialize it like
+*       PointCloud, but a sample deserialized from them only holds the fixed part and empty containers. The
+*       reader cannot tell how many bytes a loan holds, so size() is written by the writer and is_valid()
+*       bounds it by the largest sample the reader accepts. Samples cannot be copied since their containers
+*       are relative to their own address.
+*/
+
+class LoanedPointCloud
+{
+public:
+	LoanedPointCloud();
+	~LoanedPointCloud() = default;
+	LoanedPointCloud(LoanedPointCloud const &x) = delete;
+	LoanedPointCloud& operator=(LoanedPointCloud const &x) = delete;
+
+	DdsCdr& serialize(DdsCdr &cdr) const;
+
+	DdsCdr& deserialize(DdsCdr &cdr);
+
+	static bool is_key_defined();
+	void serialize_key(DdsCdr &cdr) const;
+
+	void serialize_key(char **buf,unsigned int *len);
+	bool is_key_serialize_by_cdr();
+	static bool is_plain_types();
+	uint32_t max_align_size(uint32_t const _cur_al) const;
+	static greenstone::dds::SerializedPayloadHeader const get_serialized_payload_header();
+	void set_key_val(LoanedPointCloud const* const _data) noexcept;
+
+	// Get the bytes of a loan holding a frame id of frameIdLength characters and count points
+	static uint64_t get_loan_size(uint32_t const frameIdLength, uint32_t const count);
+
+	// Whether the sample is at most maxSize bytes and its containers lie within its bytes
+	bool is_valid(uint32_t const maxSize) const;
+
+
+
+	void id(unsigned short const _id);
+	unsigned short id() const;
+	unsigned short& id();
+
+	void index(uint32_t const _index);
+	uint32_t index() const;
+	uint32_t& index();
+
+	void stamp(uint64_t const _stamp);
+	uint64_t stamp() const;
+	uint64_t& stamp();
+
+	void size(uint32_t const _size);
+	uint32_t size() const;
+
+	OffsetString const& frame_id() const;
+	OffsetString& frame_id();
+
+	OffsetVector<float> const& points() const;
+	OffsetVector<float>& points();
+
+
+
+
+
+private:
+	unsigned short m_id;
+	uint32_t m_index;
+	uint64_t m_stamp;
+	uint32_t m_size;
+	OffsetString m_frame_id;
+	OffsetVector<float> m_points;
+
+};
+
+
+#endif	// LOANEDPOINTCLOUD_H
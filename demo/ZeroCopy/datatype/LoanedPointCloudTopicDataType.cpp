@@ -0,0 +1,170 @@
+/**************************************************************
+* @file LoanedPointCloudTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "LoanedPointCloudTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+LoanedPointCloudTopicDataType::LoanedPointCloudTopicDataType() : TopicDataType()
+{
+	set_name("LoanedPointCloudTopicDataType");
+}
+LoanedPointCloudTopicDataType::~LoanedPointCloudTopicDataType()
+{
+
+}
+bool LoanedPointCloudTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	LoanedPointCloud* pData = static_cast<LoanedPointCloud*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool LoanedPointCloudTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	LoanedPointCloud* pData = static_cast<LoanedPointCloud*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool LoanedPointCloudTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!LoanedPointCloud::is_key_defined())
+	{
+		return false;
+	}
+	LoanedPointCloud* pData = static_cast<LoanedPointCloud*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool LoanedPointCloudTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!LoanedPointCloud::is_key_defined())
+	{
+		return false;
+	}
+	LoanedPointCloud *data = new LoanedPointCloud{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool LoanedPointCloudTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)LoanedPointCloud;
+
+	return true;
+}
+uint32_t LoanedPointCloudTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	LoanedPointCloud* pData = static_cast<LoanedPointCloud*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool LoanedPointCloudTopicDataType::is_with_key() noexcept
+{
+	return LoanedPointCloud::is_key_defined();
+}
+bool LoanedPointCloudTopicDataType::is_plain_types() noexcept
+{
+	return LoanedPointCloud::is_plain_types();
+}
+void* LoanedPointCloudTopicDataType::create_data_resource() noexcept
+{
+	LoanedPointCloud* pData = new LoanedPointCloud;
+
+	return pData;
+}
+void LoanedPointCloudTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	LoanedPointCloud* pData = reinterpret_cast<LoanedPointCloud*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const LoanedPointCloudTopicDataType::get_serialized_payload_header() noexcept
+{
+	return LoanedPointCloud::get_serialized_payload_header();
+}
+
+void* const LoanedPointCloudTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	LoanedPointCloud* pData = reinterpret_cast<LoanedPointCloud*>(data);
+	LoanedPointCloud* newData = new LoanedPointCloud{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const LoanedPointCloudTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	LoanedPointCloud *data = new LoanedPointCloud{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void LoanedPointCloudTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	LoanedPointCloud* pData = reinterpret_cast<LoanedPointCloud*>(data);
+	LoanedPointCloud const* const keyData = reinterpret_cast<LoanedPointCloud const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t LoanedPointCloudTopicDataType::data_size_of() noexcept
+{
+	return sizeof(LoanedPointCloud);
+}
+
@@ -0,0 +1,195 @@
+/**************************************************************
+* @file PointCloud.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "PointCloud.h"
+#include "swiftdds/rtps/CdrSize.h"
+//#include <iostream>
+
+PointCloud::PointCloud()
+{
+	m_id = 0;
+	m_index = 0;
+	m_stamp = 0;
+
+}
+
+DdsCdr& PointCloud::serialize(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+	cdr.serialize(m_index);
+	cdr.serialize(m_stamp);
+	cdr.serialize(m_frame_id);
+	cdr.serialize(m_points);
+
+	return cdr;
+}
+uint32_t PointCloud::serialize(void *const data, char *const payload_buf, uint32_t const payload_len)
+{
+	if((data == nullptr) || (payload_buf == nullptr) || (payload_len == 0U))
+	{
+		return 0U;
+	}
+	greenstone::dds::SerializedPayloadHeader const header{get_serialized_payload_header()};
+	memcpy(payload_buf, &header, 4U);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.move_length(payload_len-4U);
+	PointCloud* pData = static_cast<PointCloud*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	return cdr.get_buf(&addr);
+}
+
+DdsCdr& PointCloud::deserialize(DdsCdr &cdr)
+{
+	cdr.deserialize(m_id);
+	cdr.deserialize(m_index);
+	cdr.deserialize(m_stamp);
+	cdr.deserialize(m_frame_id);
+	cdr.deserialize(m_points);
+
+	return cdr;
+}
+bool PointCloud::deserialize(char *const payload_buf, uint32_t const payload_len, void *const data)
+{
+	PointCloud* pData = static_cast<PointCloud*>(data);
+	DdsCdr cdr;
+	cdr.set_buf(payload_buf, payload_len);
+	cdr.deserialize(*pData);
+	return true;
+}
+
+bool PointCloud::is_key_defined()
+{
+	return true;
+
+}
+void PointCloud::serialize_key(DdsCdr &cdr) const
+{
+	cdr.serialize(m_id);
+
+}
+void PointCloud::serialize_key(char **buf,unsigned int *len)
+{
+	static greenstone::dds::SerializedPayloadHeader payloadHeader{{0x00,0x01},{0x00,0x00}};
+	if(is_key_serialize_by_cdr())
+	{
+		DdsCdr cdr;
+		cdr.init(payloadHeader);
+		serialize_key(cdr);
+		*len = cdr.get_buf(reinterpret_cast<void**>(buf));
+	}
+	else
+	{
+		*buf = reinterpret_cast<char*>(&m_id);
+		*len = sizeof(unsigned short);
+	}
+
+}
+bool PointCloud::is_key_serialize_by_cdr()
+{
+	return false;
+
+}
+bool PointCloud::is_plain_types()
+{
+	return false;
+}
+uint32_t PointCloud::max_align_size(uint32_t const _cur_al) const
+{
+	uint32_t maxSize = _cur_al;
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_index);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_stamp);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_frame_id);
+	maxSize = greenstone::dds::CdrUtil::alignment(maxSize, m_points);
+	return maxSize;
+
+}
+greenstone::dds::SerializedPayloadHeader const PointCloud::get_serialized_payload_header()
+{
+	static greenstone::dds::SerializedPayloadHeader const header {{0x00,0x01},{0x00,0x00}};    // PLAIN_CDR, LITTLE_ENDIAN
+	return header;
+
+}
+void PointCloud::set_key_val(PointCloud const* const _data) noexcept
+{
+	this->m_id = _data->m_id;
+
+}
+void PointCloud::id(unsigned short const _id)
+{
+	m_id = _id;
+}
+unsigned short PointCloud::id() const
+{
+	return m_id;
+}
+unsigned short& PointCloud::id()
+{
+	return m_id;
+}
+
+void PointCloud::index(uint32_t const _index)
+{
+	m_index = _index;
+}
+uint32_t PointCloud::index() const
+{
+	return m_index;
+}
+uint32_t& PointCloud::index()
+{
+	return m_index;
+}
+
+void PointCloud::stamp(uint64_t const _stamp)
+{
+	m_stamp = _stamp;
+}
+uint64_t PointCloud::stamp() const
+{
+	return m_stamp;
+}
+uint64_t& PointCloud::stamp()
+{
+	return m_stamp;
+}
+
+void PointCloud::frame_id(std::string const &_frame_id)
+{
+	m_frame_id = _frame_id;
+}
+void PointCloud::frame_id(std::string &&_frame_id)
+{
+	m_frame_id = std::move(_frame_id);
+}
+std::string const& PointCloud::frame_id() const
+{
+	return m_frame_id;
+}
+std::string& PointCloud::frame_id()
+{
+	return m_frame_id;
+}
+
+void PointCloud::points(std::vector<float> const &_points)
+{
+	m_points = _points;
+}
+void PointCloud::points(std::vector<float> &&_points)
+{
+	m_points = std::move(_points);
+}
+std::vector<float> const& PointCloud::points() const
+{
+	return m_points;
+}
+std::vector<float>& PointCloud::points()
+{
+	return m_points;
+}
+
@@ -0,0 +1,97 @@
+/**************************************************************
+* @file PointCloud.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#ifndef POINTCLOUD_245917337f7c1ef625a413797db280c5_H
+#define POINTCLOUD_245917337f7c1ef625a413797db280c5_H
+
+#include <stdint.h>
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+#include "swiftdds/rtps/DdsOptionalMember.h"
+
+
+
+
+/**
+* @class PointCloud
+* @brief A class as the datatype for data exchange.
+* @note
+*/
+
+class PointCloud
+{
+public:
+	static constexpr bool IS_KEY_DEFINED = true;
+	static constexpr uint32_t DATA_SIZE = 0U;
+	static constexpr bool IS_DATA_PADDING = true;
+	static constexpr bool IS_ID_DEFINED = false;
+
+	PointCloud();
+	~PointCloud() = default;
+	PointCloud(PointCloud const &x) = default;
+	PointCloud(PointCloud &&x) = default;
+	PointCloud& operator=(PointCloud const &x) = default;
+	PointCloud& operator=(PointCloud &&x) = default;
+
+	DdsCdr& serialize(DdsCdr &cdr) const;
+	static uint32_t serialize(void *const data, char *const payload_buf, uint32_t const payload_len);
+
+	DdsCdr& deserialize(DdsCdr &cdr);
+	static bool deserialize(char *const payload_buf, uint32_t const payload_len, void *const data);
+
+	static bool is_key_defined();
+	void serialize_key(DdsCdr &cdr) const;
+
+	void serialize_key(char **buf,unsigned int *len);
+	bool is_key_serialize_by_cdr();
+	static bool is_plain_types();
+	uint32_t max_align_size(uint32_t const _cur_al) const;
+	static greenstone::dds::SerializedPayloadHeader const get_serialized_payload_header();
+	void set_key_val(PointCloud const* const _data) noexcept;
+
+
+
+	void id(unsigned short const _id);
+	unsigned short id() const;
+	unsigned short& id();
+
+	void index(uint32_t const _index);
+	uint32_t index() const;
+	uint32_t& index();
+
+	void stamp(uint64_t const _stamp);
+	uint64_t stamp() const;
+	uint64_t& stamp();
+
+	void frame_id(std::string const &_frame_id);
+	void frame_id(std::string &&_frame_id);
+	std::string const& frame_id() const;
+	std::string& frame_id();
+
+	void points(std::vector<float> const &_points);
+	void points(std::vector<float> &&_points);
+	std::vector<float> const& points() const;
+	std::vector<float>& points();
+
+
+
+
+
+private:
+	unsigned short m_id;
+	uint32_t m_index;
+	uint64_t m_stamp;
+	std::string m_frame_id;
+	std::vector<float> m_points;
+
+};
+
+
+#endif	// POINTCLOUD_245917337f7c1ef625a413797db280c5_H
+
@@ -0,0 +1,170 @@
+/**************************************************************
+* @file PointCloudTopicDataType.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2025
+* All rights reserved
+**************************************************************/
+
+#include "PointCloudTopicDataType.h"
+#include "swiftdds/rtps/CdrSize.h"
+
+PointCloudTopicDataType::PointCloudTopicDataType() : TopicDataType()
+{
+	set_name("PointCloudTopicDataType");
+}
+PointCloudTopicDataType::~PointCloudTopicDataType()
+{
+
+}
+bool PointCloudTopicDataType::serialize(DdsCdr& cdr, void *data, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value)
+{
+	PointCloud* pData = static_cast<PointCloud*>(data);
+	cdr.serialize(*pData);
+	void *addr{nullptr};
+	data_value->length(cdr.get_buf(&addr));
+	data_value->value(static_cast<octet *>(addr));
+	return true;
+}
+bool PointCloudTopicDataType::deserialize(DdsCdr& cdr, std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, void *data)
+{
+	PointCloud* pData = static_cast<PointCloud*>(data);
+	cdr.set_buf(reinterpret_cast<void*>(data_value->value()), data_value->length());
+	cdr.deserialize(*pData);
+	return true;
+}
+// The func of getKey is non-thread-safe
+bool PointCloudTopicDataType::get_key(void* data, InstanceHandle_t* ihandle) noexcept
+{
+	if (!PointCloud::is_key_defined())
+	{
+		return false;
+	}
+	PointCloud* pData = static_cast<PointCloud*>(data);
+	unsigned int length;
+	char *buf = nullptr;
+	pData->serialize_key(&buf,&length);
+	if (length > 16)
+	{
+		greenstone::dds::UtilHelper::generate_digest(buf,length,reinterpret_cast<char*>(ihandle->value));
+	}
+	else
+	{
+		memcpy(ihandle->value, buf, length);
+	}
+	if (buf && pData->is_key_serialize_by_cdr())
+	{
+		delete buf;
+		buf = nullptr;
+	}
+	return true;
+}
+bool PointCloudTopicDataType::get_key(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value, InstanceHandle_t* ihandle) noexcept
+{
+	if (!PointCloud::is_key_defined())
+	{
+		return false;
+	}
+	PointCloud *data = new PointCloud{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+	get_key(reinterpret_cast<void*>(data),ihandle);
+
+	delete data;
+
+	return true;
+}
+bool PointCloudTopicDataType::init_data_ptr(void* data) noexcept
+{
+	if (data == nullptr)
+	{
+		return false;
+	}
+	new(data)PointCloud;
+
+	return true;
+}
+uint32_t PointCloudTopicDataType::get_cdr_serialized_size(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return 0U;
+	}
+	PointCloud* pData = static_cast<PointCloud*>(data);
+	uint32_t max_size = pData->max_align_size(4U);
+
+	return greenstone::dds::CdrUtil::alignment_bytes(max_size, 4U);
+}
+bool PointCloudTopicDataType::is_with_key() noexcept
+{
+	return PointCloud::is_key_defined();
+}
+bool PointCloudTopicDataType::is_plain_types() noexcept
+{
+	return PointCloud::is_plain_types();
+}
+void* PointCloudTopicDataType::create_data_resource() noexcept
+{
+	PointCloud* pData = new PointCloud;
+
+	return pData;
+}
+void PointCloudTopicDataType::release_data_resource(void *data) noexcept
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+	PointCloud* pData = reinterpret_cast<PointCloud*>(data);
+	delete pData;
+	pData = nullptr;
+}
+greenstone::dds::SerializedPayloadHeader const PointCloudTopicDataType::get_serialized_payload_header() noexcept
+{
+	return PointCloud::get_serialized_payload_header();
+}
+
+void* const PointCloudTopicDataType::get_key_value_data(void * const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	PointCloud* pData = reinterpret_cast<PointCloud*>(data);
+	PointCloud* newData = new PointCloud{};
+	newData->set_key_val(pData);
+
+	return newData;
+}
+
+void* const PointCloudTopicDataType::get_key_value_data(std::shared_ptr<greenstone::dds::SerializedPayload_t> data_value) noexcept
+{
+	if(!is_with_key())
+	{
+		return nullptr;
+	}
+	PointCloud *data = new PointCloud{};
+	DdsCdr cdr;
+	deserialize(cdr,data_value,reinterpret_cast<void*>(data));
+
+	void* newData = get_key_value_data(data);
+
+	delete data;
+
+	return newData;
+}
+
+void PointCloudTopicDataType::copy_key_value_to_data(void const *const key_data, void *const data) noexcept
+{
+	if(!is_with_key())
+	{
+		return;
+	}
+	PointCloud* pData = reinterpret_cast<PointCloud*>(data);
+	PointCloud const* const keyData = reinterpret_cast<PointCloud const* const>(key_data);
+	pData->set_key_val(keyData);
+}
+
+uint32_t PointCloudTopicDataType::data_size_of() noexcept
+{
+	return sizeof(PointCloud);
+}
+
@@ -0,0 +1,201 @@
+/**************************************************************
+* @file PointCloudReader.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include "PointCloudReader.h"
+#include "ConfigParser.h"
+
+namespace
+{
+// The longest frame id a loaned point cloud may hold
+const uint32_t MAX_FRAME_ID_LENGTH = 255U;
+}
+
+void PointCloudReader::MyDataReaderListener::on_data_available(greenstone::dds::DataReader* reader) noexcept
+{
+    greenstone::dds::SampleInfo info;
+
+    if (m_loaned)
+    {
+        // The points are read in place in the loan, without deserialization
+        greenstone::dds::LoanableTypeData<LoanedPointCloud> loandata;
+        if (reader->take_next_sample(loandata, info) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            if (info.valid_data)
+            {
+                LoanedPointCloud& pointCloud = loandata.to_user_type();
+                if (pointCloud.is_valid(m_maxSize))
+                {
+                    process(pointCloud.id(), pointCloud.index(), pointCloud.stamp(),
+                        pointCloud.points().data(), pointCloud.points().size());
+                }
+                else
+                {
+                    std::cout << "[ID: " << pointCloud.id()
+                              << "; Index: " << pointCloud.index()
+                              << "] DISCARDED, the sample is larger than expected or its points lie outside of it" << std::endl;
+                }
+            }
+            reader->return_loan(loandata, info);
+        }
+    }
+    else
+    {
+        PointCloud pointCloud;
+        if (reader->take_next_sample(&pointCloud, info) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            if (info.valid_data)
+            {
+                process(pointCloud.id(), pointCloud.index(), pointCloud.stamp(),
+                    pointCloud.points().data(), static_cast<uint32_t>(pointCloud.points().size()));
+            }
+        }
+    }
+}
+
+void PointCloudReader::MyDataReaderListener::process(const uint32_t& id, const uint32_t& index,
+    const uint64_t& stamp, const float* points, const uint32_t& count)
+{
+    // User can modify the logic here for data received
+    float sum = 0;
+    for (uint32_t j = 0; j < count; j++)
+    {
+        sum += points[j];
+    }
+    uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    uint64_t latency = (now > stamp) ? (now - stamp) : 0;
+
+    ++m_received;
+    m_bytes += count * sizeof(float);
+    m_latencySum += latency;
+    m_latencyMax = (std::max)(m_latencyMax, latency);
+    std::cout << "[ID: " << id
+              << "; Index: " << index
+              << "; Received: " << m_received
+              << "; Points size: " << count * sizeof(float)
+              << " B; Latency: " << latency / 1000.0
+              << " us; Sum: " << sum
+              << "] RECEIVED" << std::endl;
+}
+
+void PointCloudReader::MyDataReaderListener::print_summary() const
+{
+    if (m_received == 0)
+    {
+        return;
+    }
+    std::cout << "Received " << m_received << " point clouds of " << m_bytes / m_received << " B on average "
+              << (m_loaned ? "from loans" : "by copy") << ", latency " << m_latencySum / m_received / 1000.0
+              << " us on average, " << m_latencyMax / 1000.0 << " us at most" << std::endl;
+}
+
+PointCloudReader::PointCloudReader(bool loaned, uint32_t dataSize)
+    : m_loaned(loaned),
+      m_participant(nullptr),
+      m_topic(nullptr),
+      m_subscriber(nullptr),
+      m_reader(nullptr),
+      m_readerListener(nullptr)
+{
+    uint64_t maxSize = LoanedPointCloud::get_loan_size(MAX_FRAME_ID_LENGTH, dataSize / sizeof(float));
+    m_readerListener = new MyDataReaderListener(loaned,
+        static_cast<uint32_t>((std::min)(maxSize, static_cast<uint64_t>((std::numeric_limits<uint32_t>::max)()))));
+}
+
+PointCloudReader::~PointCloudReader()
+{
+    delete m_readerListener;
+}
+
+bool PointCloudReader::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_sub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    greenstone::dds::TopicDataType* topicType = m_loaned ?
+        static_cast<greenstone::dds::TopicDataType*>(&m_loanedPointCloudTopicType) : &m_pointCloudTopicType;
+    m_participant->register_type(topicType);
+    std::string topicTypeName = topicType->get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create subscriber
+    m_subscriber = ConfigParser::get_instance()->get_subscriber_from_json(
+        "subscriber_cfg", m_participant, nullptr, m_mask);
+    if (m_subscriber == nullptr)
+    {
+        return false;
+    }
+
+    // Create datareader
+    m_reader = ConfigParser::get_instance()->get_reader_from_json(
+        "reader_cfg", m_subscriber, m_topic, m_readerListener, m_mask);
+    if (m_reader == nullptr)
+    {
+        return false;
+    }
+
+    // Only shared memory carries the bytes of a loan beyond the fixed part of LoanedPointCloud
+    if (m_loaned)
+    {
+        greenstone::dds::DataReaderQos qos;
+        m_reader->get_qos(qos);
+        std::vector<gstone::rtps::TransportKind_t> order = qos.attributes().prefer_transport_order();
+        if (qos.attributes().only_recv_by_udp() || order.empty() ||
+            (order[0] != gstone::rtps::TransportKind_t::TRANSPORT_KIND_SHM))
+        {
+            std::cout << "Point clouds can only be taken from loans with SHM first in prefer_transport_kind of reader_cfg" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void PointCloudReader::destroy()
+{
+    if (m_subscriber->delete_datareader(m_reader) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete reader error" << std::endl;
+    }
+    if (m_participant->delete_subscriber(m_subscriber) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete subscriber error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+void PointCloudReader::run(const uint32_t& recvLimit)
+{
+    std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+    while (!(m_readerListener->get_number_of_matched() > 0))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    while ((m_readerListener->get_number_of_matched() > 0) && (m_readerListener->m_received < recvLimit))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    }
+
+    destroy();
+
+    m_readerListener->print_summary();
+}
@@ -0,0 +1,80 @@
+/**************************************************************
+* @file PointCloudReader.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef POINTCLOUD_READER_H
+#define POINTCLOUD_READER_H
+
+#include "GeneralListeners.h"
+#include "PointCloudTopicDataType.h"
+#include "LoanedPointCloudTopicDataType.h"
+
+/**
+* @class PointCloudReader
+* @brief A wrapper class subscribing point clouds of variable size, either as LoanedPointCloud taken as a
+*        LoanableTypeData or as PointCloud taken into a sample of the application.
+* @note The latency of each sample is measured from the time the writer stamped it to the time all of its points
+*       have been read, which needs the writer to run on the same host. Loaned samples larger than a point cloud
+*       of dataSize bytes of points are discarded, since the reader cannot tell how many bytes a loan holds.
+*/
+
+class PointCloudReader
+{
+public:
+
+    PointCloudReader(bool loaned, uint32_t dataSize);
+
+    ~PointCloudReader();
+
+    // Initialize DDS entities for subscribing the point clouds
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Subscribe the point clouds
+    void run(const uint32_t& recvLimit);
+
+private:
+
+    // Whether point clouds are taken from loans
+    bool m_loaned;
+
+    // TopicDataType of both types
+    PointCloudTopicDataType m_pointCloudTopicType;
+    LoanedPointCloudTopicDataType m_loanedPointCloudTopicType;
+
+    // DDS entities for the DataReader
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Subscriber* m_subscriber;
+    greenstone::dds::DataReader* m_reader;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+
+    // A child class of GeneralReaderListener
+    class MyDataReaderListener : public GeneralReaderListener
+    {
+    public:
+        MyDataReaderListener(bool loaned, uint32_t maxSize) : m_loaned(loaned), m_maxSize(maxSize) {}
+        ~MyDataReaderListener() {}
+        void on_data_available(greenstone::dds::DataReader* reader) noexcept override;
+
+        // Read all points of a sample, and count the sample and its latency
+        void process(const uint32_t& id, const uint32_t& index, const uint64_t& stamp,
+            const float* points, const uint32_t& count);
+
+        // Print the average size and latency of the samples received
+        void print_summary() const;
+    public:
+        bool m_loaned;
+        uint32_t m_maxSize;
+        uint32_t m_received {0};
+        uint64_t m_bytes {0};
+        uint64_t m_latencySum {0};
+        uint64_t m_latencyMax {0};
+    }* m_readerListener;
+};
+
+#endif  // POINTCLOUD_READER_H
@@ -0,0 +1,226 @@
+/**************************************************************
+* @file PointCloudWriter.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#include <random>
+
+#include "PointCloudWriter.h"
+#include "ConfigParser.h"
+#include "LoanArena.h"
+
+PointCloudWriter::PointCloudWriter(bool loaned) :
+    m_loaned(loaned),
+    m_participant(nullptr),
+    m_topic(nullptr),
+    m_publisher(nullptr),
+    m_writer(nullptr),
+    m_writerListener(new MyDataWriterListener())
+{
+}
+
+PointCloudWriter::~PointCloudWriter()
+{
+    delete m_writerListener;
+}
+
+bool PointCloudWriter::init(const std::string& topicName)
+{
+    // Create participant
+    m_participant = ConfigParser::get_instance()->get_participant_from_json(
+        "participant_pub_cfg", nullptr, m_mask);
+    if (m_participant == nullptr)
+    {
+        return false;
+    }
+
+    // Create topic
+    greenstone::dds::TopicDataType* topicType = m_loaned ?
+        static_cast<greenstone::dds::TopicDataType*>(&m_loanedPointCloudTopicType) : &m_pointCloudTopicType;
+    m_participant->register_type(topicType);
+    std::string topicTypeName = topicType->get_name();
+    m_topic = ConfigParser::get_instance()->get_topic_from_json(
+        "topic_cfg", m_participant, topicName, topicTypeName, nullptr, m_mask);
+
+    // Create publisher
+    m_publisher = ConfigParser::get_instance()->get_publisher_from_json(
+        "publisher_cfg", m_participant, nullptr,  m_mask);
+    if (m_publisher == nullptr)
+    {
+        return false;
+    }
+
+    // Create datawriter
+    m_writer = ConfigParser::get_instance()->get_writer_from_json(
+        "writer_cfg", m_publisher, m_topic, m_writerListener, m_mask);
+    if (m_writer == nullptr)
+    {
+        return false;
+    }
+
+    // Only shared memory with zero copy carries the bytes of a loan beyond the fixed part of LoanedPointCloud
+    if (m_loaned)
+    {
+        greenstone::dds::DataWriterQos qos;
+        m_writer->get_qos(qos);
+        std::vector<gstone::rtps::TransportKind_t> order = qos.attributes().prefer_transport_order();
+        if (!qos.attributes().enable_zero_copy() || qos.attributes().only_recv_by_udp() || order.empty() ||
+            (order[0] != gstone::rtps::TransportKind_t::TRANSPORT_KIND_SHM))
+        {
+            std::cout << "Point clouds can only be loaned with enableZeroCopy and SHM first in prefer_transport_kind of writer_cfg" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void PointCloudWriter::destroy()
+{
+    if (m_publisher->delete_datawriter(m_writer) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete writer error" << std::endl;
+    }
+    if (m_participant->delete_publisher(m_publisher) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete publisher error" << std::endl;
+    }
+    if (m_participant->delete_topic(m_topic) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete topic error" << std::endl;
+    }
+    if (greenstone::dds::DomainParticipantFactory::get_instance()->delete_participant(m_participant) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        std::cout << "Delete participant error" << std::endl;
+    }
+}
+
+void PointCloudWriter::run(
+    const uint32_t& sensorId,
+    const uint32_t& numOfInstances,
+    const uint32_t& dataSize,
+    const uint32_t& sampleCount,
+    const uint32_t& sleepTime,
+    const uint32_t& finalSleep,
+    const bool& wait)
+{
+    if (wait)
+    {
+        std::cout << "\nWaiting for listeners to be matched..." << std::endl;
+
+        while (!(m_writerListener->get_number_of_matched() > 0))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        }
+
+        std::cout << "Listeners have been matched successfully." << std::endl;
+    }
+
+    std::cout << "Sending data..." << std::endl;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    // The same sequence of sizes in both modes
+    std::minstd_rand sizes(sensorId);
+    std::uniform_int_distribution<uint32_t> points(dataSize / 2 / sizeof(float), dataSize / sizeof(float));
+    uint64_t bytesSent = 0;
+    uint64_t writeTime = 0;
+    uint32_t sent = 0;
+
+    for (uint32_t i = 1; i <= sampleCount; i++)
+    {
+        uint32_t id = sensorId + (i - 1) % numOfInstances;
+        uint32_t count = points(sizes);
+        std::string frameId = "lidar_" + std::to_string(id);
+
+        // Time filling and writing the sample, the way an application producing it would
+        auto start = std::chrono::steady_clock::now();
+        bool written = m_loaned ? write_loaned(id, i, frameId, count) : write_copied(id, i, frameId, count);
+        writeTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "[ID: " << id
+                  << "; Index: " << i
+                  << "; Points size: " << count * sizeof(float)
+                  << " B] " << (written ? "SENT" : "SENT FAILED!") << std::endl;
+        if (written)
+        {
+            ++sent;
+            bytesSent += count * sizeof(float);
+        }
+
+        // Sleep for a period
+        if (sleepTime > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleepTime));
+        }
+    }
+
+    if (sent > 0)
+    {
+        std::cout << "Sent " << sent << " point clouds of " << bytesSent / sent << " B on average "
+                  << (m_loaned ? "through loans" : "through write") << ", filling and writing took "
+                  << writeTime / sampleCount / 1000.0 << " us per sample" << std::endl;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(finalSleep));
+
+    destroy();
+}
+
+bool PointCloudWriter::write_loaned(const uint32_t& id, const uint32_t& index, const std::string& frameId, const uint32_t& count)
+{
+    // The loan holds the fixed part followed by the frame id and the points, and cannot grow afterwards
+    uint64_t size = LoanedPointCloud::get_loan_size(static_cast<uint32_t>(frameId.size()), count);
+    void* ptr = nullptr;
+    if ((size > (std::numeric_limits<uint32_t>::max)()) ||
+        (m_writer->loan_sample(ptr, static_cast<uint32_t>(size)) != greenstone::dds::ReturnCode_t::RETCODE_OK) ||
+        (ptr == nullptr))
+    {
+        return false;
+    }
+    LoanedPointCloud* pointCloud = new(ptr) LoanedPointCloud;
+    LoanArena arena(ptr, static_cast<uint32_t>(size), sizeof(LoanedPointCloud));
+
+    // User can modify the data to be written here, the points are filled in place in the loan
+    pointCloud->id(id);
+    pointCloud->index(index);
+    float* values = nullptr;
+    if (!arena.assign(pointCloud->frame_id(), frameId) ||
+        (((values = arena.allocate(pointCloud->points(), count)) == nullptr) && (count > 0)))
+    {
+        std::cout << "Point cloud of " << count << " points does not fit in its loan of " << size << " B" << std::endl;
+        m_writer->return_loan(ptr);
+        return false;
+    }
+    for (uint32_t j = 0; j < count; j++)
+    {
+        values[j] = static_cast<float>(index + j);
+    }
+    pointCloud->size(arena.get_used());
+    pointCloud->stamp(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+
+    // Send data
+    bool written = (m_writer->write(pointCloud, m_handle) == greenstone::dds::ReturnCode_t::RETCODE_OK);
+    m_writer->return_loan(ptr);
+    return written;
+}
+
+bool PointCloudWriter::write_copied(const uint32_t& id, const uint32_t& index, const std::string& frameId, const uint32_t& count)
+{
+    // User can modify the data to be written here
+    m_pointCloud.id(id);
+    m_pointCloud.index(index);
+    m_pointCloud.frame_id(frameId);
+    std::vector<float>& values = m_pointCloud.points();
+    values.resize(count);
+    for (uint32_t j = 0; j < count; j++)
+    {
+        values[j] = static_cast<float>(index + j);
+    }
+    m_pointCloud.stamp(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+
+    // Send data
+    return m_writer->write(&m_pointCloud, m_handle) == greenstone::dds::ReturnCode_t::RETCODE_OK;
+}
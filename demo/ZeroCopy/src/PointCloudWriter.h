@@ -0,0 +1,78 @@
+/**************************************************************
+* @file PointCloudWriter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+* All rights reserved
+**************************************************************/
+
+#ifndef POINTCLOUD_WRITER_H
+#define POINTCLOUD_WRITER_H
+
+#include "GeneralListeners.h"
+#include "PointCloudTopicDataType.h"
+#include "LoanedPointCloudTopicDataType.h"
+
+/**
+* @class PointCloudWriter
+* @brief A wrapper class publishing point clouds of variable size, either as LoanedPointCloud through loans or
+*        as PointCloud through write.
+* @note
+*/
+
+class PointCloudWriter
+{
+public:
+
+    explicit PointCloudWriter(bool loaned);
+
+    ~PointCloudWriter();
+
+    // Initialize DDS entities for publishing the point clouds
+    bool init(const std::string& topicName);
+
+    // Destroy DDS entities
+    void destroy();
+
+    // Publish point clouds of dataSize / 2 to dataSize bytes of points
+    void run(
+        const uint32_t& sensorId,
+        const uint32_t& numOfInstances,
+        const uint32_t& dataSize,
+        const uint32_t& sampleCount,
+        const uint32_t& sleepTime,
+        const uint32_t& finalSleep,
+        const bool& wait);
+
+private:
+
+    // Write a point cloud of count points through a loan, return false if it could not be written
+    bool write_loaned(const uint32_t& id, const uint32_t& index, const std::string& frameId, const uint32_t& count);
+
+    // Write a point cloud of count points through write, return false if it could not be written
+    bool write_copied(const uint32_t& id, const uint32_t& index, const std::string& frameId, const uint32_t& count);
+
+    // Whether point clouds are written through loans
+    bool m_loaned;
+
+    // Instance of PointCloud, and TopicDataType of both types
+    PointCloud m_pointCloud;
+    PointCloudTopicDataType m_pointCloudTopicType;
+    LoanedPointCloudTopicDataType m_loanedPointCloudTopicType;
+
+    // DDS entities for the datawriter
+    greenstone::dds::DomainParticipant* m_participant;
+    greenstone::dds::Topic* m_topic;
+    greenstone::dds::Publisher* m_publisher;
+    greenstone::dds::DataWriter* m_writer;
+    greenstone::dds::StatusMask m_mask {greenstone::dds::AllStatusMask};
+    greenstone::dds::InstanceHandle_t m_handle;
+
+    // A child class of GeneralWriterListener
+    class MyDataWriterListener : public GeneralWriterListener
+    {
+    public:
+        MyDataWriterListener() {}
+        ~MyDataWriterListener() {}
+    }* m_writerListener;
+};
+
+#endif  // POINTCLOUD_WRITER_H
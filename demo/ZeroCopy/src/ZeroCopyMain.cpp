@@ -9,6 +9,8 @@
 
 #include "ZeroCopyWriter.h"
 #include "ZeroCopyReader.h"
+#include "PointCloudWriter.h"
+#include "PointCloudReader.h"
 #include "ConfigParser.h"
 
 enum ParseResult
@@ -24,6 +26,13 @@ enum NodeType
     SUBSCRIBER
 };
 
+enum DataMode
+{
+    FIXED,
+    LOANED_POINT_CLOUD,
+    COPIED_POINT_CLOUD
+};
+
 struct ParsedArguments 
 {
     NodeType nodeType;
@@ -37,6 +46,7 @@ struct ParsedArguments
     uint32_t finalSleep;
     bool wait;
     uint32_t recvLimit;
+    DataMode dataMode;
     ParseResult parseResult;
 };
 
@@ -67,6 +77,7 @@ inline ParsedArguments parse_arguments(int argc, char* argv[])
     parsedArguments.finalSleep = 0;
     parsedArguments.wait = false;
     parsedArguments.recvLimit = (std::numeric_limits<uint32_t>::max)();
+    parsedArguments.dataMode = DataMode::FIXED;
     parsedArguments.parseResult = ParseResult::SUCCESS;
 
     int argCount = 1;
@@ -242,6 +253,34 @@ inline ParsedArguments parse_arguments(int argc, char* argv[])
             }
             argCount += 2;
         } 
+        else if (strcmp(argv[argCount], "-m") == 0 || strcmp(argv[argCount], "--mode") == 0) 
+        {
+            if (argCount + 1 == argc) 
+            {
+                std::cout << "Data mode is missed" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            } 
+            else if (strcmp(argv[argCount + 1], "fixed") == 0) 
+            {
+                parsedArguments.dataMode = DataMode::FIXED;
+            } 
+            else if (strcmp(argv[argCount + 1], "loan") == 0) 
+            {
+                parsedArguments.dataMode = DataMode::LOANED_POINT_CLOUD;
+            } 
+            else if (strcmp(argv[argCount + 1], "copy") == 0) 
+            {
+                parsedArguments.dataMode = DataMode::COPIED_POINT_CLOUD;
+            } 
+            else 
+            {
+                std::cout << "Data mode needs to be assigned as 'fixed', 'loan' or 'copy'" << std::endl;
+                parsedArguments.parseResult = ParseResult::FAILURE;
+                break;
+            }
+            argCount += 2;
+        } 
         else 
         {
             std::cout << "Wrong arguments. Please check optional arguments as below.\n" << std::endl;
@@ -268,7 +307,7 @@ inline ParsedArguments parse_arguments(int argc, char* argv[])
                     "                                         ONLY effective on Writer"
                     "                                         Default: 1\n"
                     "    -b, --data-byte        <int>         The size of data to be sent (byte)\n"\
-                    "                                         ONLY effective on Writer"
+                    "                                         ONLY effective on Writer, and on Reader in loan mode"
                     "                                         Default: 60000\n"
                     "    -s, --sample-count     <int>         Number of samples to be sent\n"
                     "                                         ONLY effective on Writer"
@@ -285,6 +324,12 @@ inline ParsedArguments parse_arguments(int argc, char* argv[])
                     "    -l, --rec-limit        <int>         Total number of samples to be received\n"
                     "                                         ONLY effective on Reader"
                     "                                         Default: infinite\n"
+                    "    -m, --mode             <string>      Datatype and the way it is written\n"\
+                    "                                         Values: fixed (ZeroCopy through loans),\n"\
+                    "                                         loan (variable-size LoanedPointCloud through loans),\n"\
+                    "                                         copy (variable-size PointCloud through write)\n"\
+                    "                                         Point clouds hold -b / 2 to -b bytes of points\n"\
+                    "                                         Default: fixed\n"
         << std::endl;
     }
 
@@ -309,6 +354,18 @@ int main(int argc, char *argv[])
         {
             case NodeType::PUBLISHER:
             {
+                if (arguments.dataMode != DataMode::FIXED)
+                {
+                    // Create an instance of DataWriter to send point clouds
+                    PointCloudWriter dataWriter(arguments.dataMode == DataMode::LOANED_POINT_CLOUD);
+                    if (dataWriter.init(arguments.topicName))
+                    {
+                        dataWriter.run(arguments.sensorId, arguments.numOfInstances, arguments.dataByte, 
+                            arguments.sampleCount, arguments.sleepTime, arguments.finalSleep, arguments.wait);
+                    }
+                    break;
+                }
+
                 // Create an instance of DataWriter to send data
                 ZeroCopyWriter dataWriter;
                 if (dataWriter.init(arguments.topicName))
@@ -320,6 +377,17 @@ int main(int argc, char *argv[])
             }
             case NodeType::SUBSCRIBER:
             {
+                if (arguments.dataMode != DataMode::FIXED)
+                {
+                    // Create an instance of DataReader to receive point clouds
+                    PointCloudReader dataReader(arguments.dataMode == DataMode::LOANED_POINT_CLOUD, arguments.dataByte);
+                    if (dataReader.init(arguments.topicName))
+                    {
+                        dataReader.run(arguments.recvLimit);
+                    }
+                    break;
+                }
+
                 // Create an instance of DataReader to receive data
                 ZeroCopyReader dataReader;
                 if (dataReader.init(arguments.topicName))
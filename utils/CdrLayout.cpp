@@ -0,0 +1,318 @@
+/**************************************************************
+* @file CdrLayout.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "CdrLayout.h"
+
+namespace {
+    // Representation identifiers of plain CDR in the encapsulation header
+    const uint8_t CDR_BE = 0x00;
+    const uint8_t CDR_LE = 0x01;
+    const uint32_t ENCAPSULATION_HEADER_SIZE = 4;
+
+    bool host_is_little_endian()
+    {
+        const uint16_t probe = 1;
+        return *reinterpret_cast<const uint8_t*>(&probe) == 1;
+    }
+
+    // Resolve aliases to the underlying type
+    greenstone::dds::DynamicType_ptr resolve(greenstone::dds::DynamicType_ptr type)
+    {
+        while (type && (type->get_kind() == greenstone::dds::TK_ALIAS) && type->get_base_type())
+        {
+            type = type->get_base_type();
+        }
+        return type;
+    }
+
+    // Reverse the byte order of each element in place, written as plain shifts over whole elements
+    // so that the compiler can turn the loop into vector byte shuffles
+    void swap_elements(uint16_t* values, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            values[i] = static_cast<uint16_t>((values[i] >> 8) | (values[i] << 8));
+        }
+    }
+
+    void swap_elements(uint32_t* values, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t value = values[i];
+            values[i] = (value >> 24) | ((value >> 8) & 0x0000FF00U) | ((value << 8) & 0x00FF0000U) | (value << 24);
+        }
+    }
+
+    void swap_elements(uint64_t* values, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint64_t value = values[i];
+            value = ((value >> 8) & 0x00FF00FF00FF00FFULL) | ((value & 0x00FF00FF00FF00FFULL) << 8);
+            value = ((value >> 16) & 0x0000FFFF0000FFFFULL) | ((value & 0x0000FFFF0000FFFFULL) << 16);
+            values[i] = (value >> 32) | (value << 32);
+        }
+    }
+}
+
+CdrPayload::CdrPayload(const uint8_t* payload, uint32_t payloadLength)
+{
+    if ((payload == nullptr) || (payloadLength < ENCAPSULATION_HEADER_SIZE) || (payload[0] != 0x00) ||
+        ((payload[1] != CDR_BE) && (payload[1] != CDR_LE)))
+    {
+        return;
+    }
+
+    data = payload + ENCAPSULATION_HEADER_SIZE;
+    length = payloadLength - ENCAPSULATION_HEADER_SIZE;
+    swap = (payload[1] == CDR_LE) != host_is_little_endian();
+    valid = true;
+}
+
+void CdrLayout::read_elements(const CdrPayload& payload, uint32_t offset, void* values, uint32_t count, uint32_t size)
+{
+    memcpy(values, payload.data + offset, static_cast<size_t>(count) * size);
+    if (!payload.swap)
+    {
+        return;
+    }
+
+    switch (size)
+    {
+        case 2:
+            swap_elements(static_cast<uint16_t*>(values), count);
+            break;
+        case 4:
+            swap_elements(static_cast<uint32_t*>(values), count);
+            break;
+        case 8:
+            swap_elements(static_cast<uint64_t*>(values), count);
+            break;
+        default:
+            // Single bytes have no byte order
+            break;
+    }
+}
+
+uint32_t CdrLayout::primitive_size(greenstone::dds::TypeKind kind)
+{
+    switch (kind)
+    {
+        case greenstone::dds::TK_BOOLEAN:
+        case greenstone::dds::TK_BYTE:
+        case greenstone::dds::TK_INT8:
+        case greenstone::dds::TK_UINT8:
+        case greenstone::dds::TK_CHAR8:
+            return 1;
+        case greenstone::dds::TK_INT16:
+        case greenstone::dds::TK_UINT16:
+        case greenstone::dds::TK_CHAR16:
+            return 2;
+        case greenstone::dds::TK_INT32:
+        case greenstone::dds::TK_UINT32:
+        case greenstone::dds::TK_FLOAT32:
+        case greenstone::dds::TK_ENUM:
+            return 4;
+        case greenstone::dds::TK_INT64:
+        case greenstone::dds::TK_UINT64:
+        case greenstone::dds::TK_FLOAT64:
+            return 8;
+        case greenstone::dds::TK_FLOAT128:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+bool CdrLayout::build(const greenstone::dds::DynamicType_ptr& type)
+{
+    m_fields.clear();
+    m_reachable = 0;
+    m_nextFixedOffset = 0;
+
+    greenstone::dds::DynamicType_ptr resolved = resolve(type);
+    if (!resolved || (resolved->get_kind() != greenstone::dds::TK_STRUCTURE))
+    {
+        return false;
+    }
+
+    flatten(resolved, "");
+
+    while ((m_reachable < m_fields.size()) && (m_fields[m_reachable].fieldClass != FieldClass::OPAQUE))
+    {
+        ++m_reachable;
+    }
+    return true;
+}
+
+void CdrLayout::flatten(const greenstone::dds::DynamicType_ptr& type, const std::string& prefix)
+{
+    // Members are kept ordered by member id, which is the declaration order for final structs
+    for (const auto& member : type->get_all_members())
+    {
+        greenstone::dds::DynamicType_ptr memberType = resolve(member.second->get_type());
+        if (!memberType)
+        {
+            continue;
+        }
+
+        Field field;
+        field.name = prefix + member.second->get_name();
+        field.kind = memberType->get_kind();
+        field.fieldClass = FieldClass::OPAQUE;
+        field.size = primitive_size(field.kind);
+        field.count = 1;
+
+        if (field.kind == greenstone::dds::TK_STRUCTURE)
+        {
+            flatten(memberType, field.name + ".");
+            continue;
+        }
+
+        if (field.size > 0)
+        {
+            field.fieldClass = FieldClass::PRIMITIVE;
+        }
+        else if (field.kind == greenstone::dds::TK_STRING8)
+        {
+            field.fieldClass = FieldClass::STRING;
+            field.size = 1;
+        }
+        else if ((field.kind == greenstone::dds::TK_ARRAY) || (field.kind == greenstone::dds::TK_SEQUENCE))
+        {
+            greenstone::dds::DynamicType_ptr elementType = resolve(memberType->get_element_type());
+            uint32_t elementSize = elementType ? primitive_size(elementType->get_kind()) : 0;
+            if (elementSize > 0)
+            {
+                field.fieldClass = (field.kind == greenstone::dds::TK_ARRAY) ? FieldClass::ARRAY : FieldClass::SEQUENCE;
+                field.kind = elementType->get_kind();
+                field.size = elementSize;
+                if (field.fieldClass == FieldClass::ARRAY)
+                {
+                    for (uint32_t i = 0; i < memberType->get_bounds_size(); i++)
+                    {
+                        field.count *= memberType->get_bounds(i);
+                    }
+                }
+            }
+        }
+
+        // A fixed offset is known as long as no variable-length field precedes
+        field.fixedOffset = -1;
+        if (m_nextFixedOffset >= 0)
+        {
+            switch (field.fieldClass)
+            {
+                case FieldClass::PRIMITIVE:
+                case FieldClass::ARRAY:
+                    field.fixedOffset = align(static_cast<uint32_t>(m_nextFixedOffset), field.size);
+                    m_nextFixedOffset = field.fixedOffset + static_cast<int64_t>(field.size) * field.count;
+                    break;
+                case FieldClass::STRING:
+                case FieldClass::SEQUENCE:
+                    field.fixedOffset = align(static_cast<uint32_t>(m_nextFixedOffset), 4);
+                    m_nextFixedOffset = -1;
+                    break;
+                default:
+                    m_nextFixedOffset = -1;
+                    break;
+            }
+        }
+
+        m_fields.push_back(field);
+    }
+}
+
+int32_t CdrLayout::find_field(const std::string& name) const
+{
+    for (size_t i = 0; i < m_fields.size(); i++)
+    {
+        if (m_fields[i].name == name)
+        {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+uint32_t CdrLayout::skip(const CdrPayload& payload, const Field& field, uint32_t offset) const
+{
+    uint64_t end = 0;
+    switch (field.fieldClass)
+    {
+        case FieldClass::PRIMITIVE:
+        case FieldClass::ARRAY:
+            end = static_cast<uint64_t>(offset) + static_cast<uint64_t>(field.size) * field.count;
+            break;
+        case FieldClass::STRING:
+        case FieldClass::SEQUENCE:
+        {
+            if (static_cast<uint64_t>(offset) + 4 > payload.length)
+            {
+                return 0;
+            }
+            uint32_t count = read<uint32_t>(payload, offset);
+            end = offset + 4;
+            if ((field.fieldClass == FieldClass::SEQUENCE) && (count > 0))
+            {
+                end = align(static_cast<uint32_t>(end), field.size);
+            }
+            end += static_cast<uint64_t>(count) * field.size;
+            break;
+        }
+        default:
+            return 0;
+    }
+    return (end <= payload.length) ? static_cast<uint32_t>(end) : 0;
+}
+
+uint32_t CdrLayout::locate(
+    const CdrPayload& payload,
+    uint32_t last,
+    std::vector<uint32_t>& offsets,
+    uint32_t located) const
+{
+    if (m_reachable == 0)
+    {
+        return 0;
+    }
+    if (last >= m_reachable)
+    {
+        last = m_reachable - 1;
+    }
+    if (offsets.size() < m_fields.size())
+    {
+        offsets.resize(m_fields.size());
+    }
+
+    for (uint32_t i = located; i <= last; i++)
+    {
+        const Field& field = m_fields[i];
+        uint32_t offset = 0;
+        if (field.fixedOffset >= 0)
+        {
+            offset = static_cast<uint32_t>(field.fixedOffset);
+        }
+        else
+        {
+            uint32_t previousEnd = skip(payload, m_fields[i - 1], offsets[i - 1]);
+            if (previousEnd == 0)
+            {
+                return i;
+            }
+            bool lengthPrefixed = (field.fieldClass == FieldClass::STRING) || (field.fieldClass == FieldClass::SEQUENCE);
+            offset = align(previousEnd, lengthPrefixed ? 4 : field.size);
+        }
+
+        if (offset >= payload.length)
+        {
+            return i;
+        }
+        offsets[i] = offset;
+    }
+    return last + 1;
+}
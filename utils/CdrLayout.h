@@ -0,0 +1,161 @@
+/**************************************************************
+* @file CdrLayout.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef CDR_LAYOUT_H
+#define CDR_LAYOUT_H
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @struct CdrPayload
+* @brief A serialized sample as received on the wire: a 4 byte encapsulation header followed by the CDR data.
+* @note Only plain CDR (XCDR1, CDR_BE and CDR_LE) is supported, which is what SWIFT DDS sends for final types.
+*/
+
+struct CdrPayload
+{
+    // Start of the CDR data, right after the encapsulation header
+    const uint8_t* data {nullptr};
+
+    // Length of the CDR data
+    uint32_t length {0};
+
+    // Whether the byte order of the data differs from the host
+    bool swap {false};
+
+    // Whether the encapsulation header is supported
+    bool valid {false};
+
+    CdrPayload() {}
+
+    // Parse the encapsulation header of a serialized payload
+    CdrPayload(const uint8_t* payload, uint32_t payloadLength);
+};
+
+/**
+* @class CdrLayout
+* @brief This class flattens a struct DynamicType into the list of fields that can be accessed in its CDR
+*        representation, together with the information needed to locate each field without deserializing.
+* @note Members of nested structs are flattened with dotted names, e.g. "pos.x". Fields whose offset does not
+*       depend on any preceding variable-length field get a fixed offset that is computed once here.
+*/
+
+class CdrLayout
+{
+public:
+    // How a field is laid out in CDR
+    enum class FieldClass
+    {
+        PRIMITIVE,
+        STRING,
+        ARRAY,
+        SEQUENCE,
+        OPAQUE
+    };
+
+    // A flattened field of the type
+    struct Field
+    {
+        // Dotted path of the member
+        std::string name;
+
+        // Kind of the primitive, or of the element for arrays and sequences
+        greenstone::dds::TypeKind kind;
+
+        // Layout class of the field
+        FieldClass fieldClass;
+
+        // Size of the primitive or of one element in bytes
+        uint32_t size;
+
+        // Number of elements of an array
+        uint32_t count;
+
+        // Offset from the start of the CDR data, -1 if it depends on preceding variable-length fields
+        int64_t fixedOffset;
+    };
+
+    CdrLayout() {}
+
+    // Build the layout of a struct type, return false if the type is not a struct
+    bool build(const greenstone::dds::DynamicType_ptr& type);
+
+    // Get all flattened fields
+    const std::vector<Field>& fields() const
+    {
+        return m_fields;
+    }
+
+    // Get the index of a field by its dotted name, -1 if not found
+    int32_t find_field(const std::string& name) const;
+
+    // Number of leading fields that can be located, fields after an opaque field cannot
+    uint32_t reachable_fields() const
+    {
+        return m_reachable;
+    }
+
+    // Locate fields [located, last] of a payload into offsets, where offsets[0, located) are already known.
+    // Return the number of fields located in total, which is less than last + 1 if the payload is truncated.
+    uint32_t locate(
+        const CdrPayload& payload,
+        uint32_t last,
+        std::vector<uint32_t>& offsets,
+        uint32_t located = 0) const;
+
+    // Get the size of a primitive kind in bytes, 0 if it is not a primitive
+    static uint32_t primitive_size(greenstone::dds::TypeKind kind);
+
+    // Read a primitive from a payload, converting byte order if needed
+    template<typename T>
+    static T read(const CdrPayload& payload, uint32_t offset)
+    {
+        T value;
+        memcpy(&value, payload.data + offset, sizeof(T));
+        if (payload.swap)
+        {
+            uint8_t* bytes = reinterpret_cast<uint8_t*>(&value);
+            for (size_t i = 0; i < sizeof(T) / 2; i++)
+            {
+                uint8_t tmp = bytes[i];
+                bytes[i] = bytes[sizeof(T) - 1 - i];
+                bytes[sizeof(T) - 1 - i] = tmp;
+            }
+        }
+        return value;
+    }
+
+    // Read count contiguous primitives of the given size from a payload, converting byte order if needed
+    static void read_elements(const CdrPayload& payload, uint32_t offset, void* values, uint32_t count, uint32_t size);
+
+    // Align an offset to the CDR alignment of a primitive of the given size
+    static uint32_t align(uint32_t offset, uint32_t size)
+    {
+        uint32_t alignment = (size > 8) ? 8 : ((size == 0) ? 1 : size);
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+private:
+    // Flatten the members of a struct type with a name prefix
+    void flatten(const greenstone::dds::DynamicType_ptr& type, const std::string& prefix);
+
+    // Get the end of a field starting at offset, return 0 if the payload is truncated
+    uint32_t skip(const CdrPayload& payload, const Field& field, uint32_t offset) const;
+
+    // Flattened fields
+    std::vector<Field> m_fields;
+
+    // Number of reachable fields
+    uint32_t m_reachable {0};
+
+    // Fixed offset following the last flattened field, -1 once a variable-length field is met
+    int64_t m_nextFixedOffset {0};
+};
+
+#endif // CDR_LAYOUT_H
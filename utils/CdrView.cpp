@@ -0,0 +1,196 @@
+/**************************************************************
+* @file CdrView.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include <map>
+#include <mutex>
+#include "CdrView.h"
+
+namespace {
+    struct CachedLayout
+    {
+        std::weak_ptr<greenstone::dds::DynamicType> type;
+        std::shared_ptr<const CdrLayout> layout;
+    };
+
+    std::mutex g_layoutMutex;
+    std::map<const greenstone::dds::DynamicType*, CachedLayout> g_layouts;
+}
+
+std::shared_ptr<const CdrLayout> CdrView::get_layout(const greenstone::dds::DynamicType_ptr& type)
+{
+    if (!type)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(g_layoutMutex);
+    auto it = g_layouts.find(type.get());
+    // A type destroyed and another created at the same address must not reuse the layout
+    if ((it != g_layouts.end()) && (it->second.type.lock() == type))
+    {
+        return it->second.layout;
+    }
+
+    std::shared_ptr<CdrLayout> layout = std::make_shared<CdrLayout>();
+    if (!layout->build(type))
+    {
+        return nullptr;
+    }
+
+    // Drop the layouts of the types destroyed since, so that the cache does not grow with every type created
+    for (it = g_layouts.begin(); it != g_layouts.end();)
+    {
+        if (it->second.type.expired())
+        {
+            it = g_layouts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    CachedLayout& cached = g_layouts[type.get()];
+    cached.type = type;
+    cached.layout = layout;
+    return cached.layout;
+}
+
+CdrView::CdrView(const greenstone::dds::DynamicType_ptr& type)
+    : m_layout(get_layout(type))
+{
+    if (!m_layout)
+    {
+        return;
+    }
+
+    m_offsets.resize(m_layout->fields().size());
+    for (const auto& member : type->get_all_members())
+    {
+        m_memberFields[member.first] = m_layout->find_field(member.second->get_name());
+    }
+}
+
+int32_t CdrView::get_field(const greenstone::dds::MemberId id) const
+{
+    auto it = m_memberFields.find(id);
+    return (it != m_memberFields.end()) ? it->second : -1;
+}
+
+bool CdrView::reset(const uint8_t* payload, uint32_t length)
+{
+    m_payload = CdrPayload(payload, length);
+    m_located = 0;
+    return m_payload.valid;
+}
+
+int64_t CdrView::offset_of(uint32_t field)
+{
+    if (!m_payload.valid)
+    {
+        return -1;
+    }
+
+    const CdrLayout::Field& layoutField = m_layout->fields()[field];
+    if (layoutField.fixedOffset >= 0)
+    {
+        return layoutField.fixedOffset;
+    }
+    if (field >= m_located)
+    {
+        m_located = m_layout->locate(m_payload, field, m_offsets, m_located);
+        if (field >= m_located)
+        {
+            return -1;
+        }
+    }
+    return m_offsets[field];
+}
+
+greenstone::dds::ReturnCode_t CdrView::locate_elements(uint32_t field, uint32_t& offset, uint32_t& count)
+{
+    const CdrLayout::Field& layoutField = m_layout->fields()[field];
+    if ((layoutField.fieldClass != CdrLayout::FieldClass::ARRAY) &&
+        (layoutField.fieldClass != CdrLayout::FieldClass::SEQUENCE))
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    int64_t start = offset_of(field);
+    if (start < 0)
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    uint64_t end = static_cast<uint64_t>(start);
+    count = layoutField.count;
+    if (layoutField.fieldClass == CdrLayout::FieldClass::SEQUENCE)
+    {
+        if (end + 4 > m_payload.length)
+        {
+            return greenstone::dds::ReturnCode_t::RETCODE_NO_DATA;
+        }
+        count = CdrLayout::read<uint32_t>(m_payload, static_cast<uint32_t>(end));
+        end += 4;
+        if (count > 0)
+        {
+            end = CdrLayout::align(static_cast<uint32_t>(end), layoutField.size);
+        }
+    }
+
+    offset = static_cast<uint32_t>(end);
+    if (end + static_cast<uint64_t>(count) * layoutField.size > m_payload.length)
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_NO_DATA;
+    }
+    return greenstone::dds::ReturnCode_t::RETCODE_OK;
+}
+
+greenstone::dds::ReturnCode_t CdrView::get_item_count(uint32_t& count, uint32_t field)
+{
+    if (!m_layout || (field >= m_layout->fields().size()))
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    uint32_t offset = 0;
+    return locate_elements(field, offset, count);
+}
+
+greenstone::dds::ReturnCode_t CdrView::get_string_view(const char*& data, uint32_t& length, uint32_t field)
+{
+    if (!m_layout || (field >= m_layout->fields().size()) ||
+        (m_layout->fields()[field].fieldClass != CdrLayout::FieldClass::STRING))
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    int64_t offset = offset_of(field);
+    if ((offset < 0) || (static_cast<uint64_t>(offset) + 4 > m_payload.length))
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_NO_DATA;
+    }
+    uint32_t serializedLength = CdrLayout::read<uint32_t>(m_payload, static_cast<uint32_t>(offset));
+    if (static_cast<uint64_t>(offset) + 4 + serializedLength > m_payload.length)
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    // The serialized length includes the terminating NUL
+    data = reinterpret_cast<const char*>(m_payload.data + offset + 4);
+    length = (serializedLength > 0) ? serializedLength - 1 : 0;
+    return greenstone::dds::ReturnCode_t::RETCODE_OK;
+}
+
+greenstone::dds::ReturnCode_t CdrView::get_string_value(std::string& value, uint32_t field)
+{
+    const char* data = nullptr;
+    uint32_t length = 0;
+    greenstone::dds::ReturnCode_t ret = get_string_view(data, length, field);
+    if (ret == greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        value.assign(data, length);
+    }
+    return ret;
+}
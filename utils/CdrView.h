@@ -0,0 +1,307 @@
+/**************************************************************
+* @file CdrView.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef CDR_VIEW_H
+#define CDR_VIEW_H
+
+#include <map>
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CdrLayout.h"
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class CdrView
+* @brief This class reads single fields of a serialized sample in place, as an alternative to deserializing
+*        the whole sample into a DynamicData when only a few fields are needed.
+* @note The layout of a type is built once and shared by all views of the same DynamicType. Fields are located
+*       lazily: fields with a fixed offset are read directly, the others are located on first access up to
+*       the field requested and the offsets are kept until the next reset(). Reading primitive fields does
+*       not allocate. Fields are addressed by their index in the layout, which is resolved once from a
+*       MemberId of the type or from a dotted name such as "pos.x". Fields following a member the layout
+*       cannot skip, such as a sequence of structs, return RETCODE_NO_DATA. Arrays and sequences of primitives
+*       are copied with one memcpy, followed by a byte swap of the whole range if the byte order differs.
+*       A view is not thread-safe.
+*/
+
+class CdrView
+{
+public:
+    // Create a view for samples of a struct type
+    explicit CdrView(const greenstone::dds::DynamicType_ptr& type);
+
+    // Get the layout of a type, built on first use and cached for the lifetime of the type, the layouts of
+    // destroyed types are dropped when the next one is built
+    static std::shared_ptr<const CdrLayout> get_layout(const greenstone::dds::DynamicType_ptr& type);
+
+    // Attach a serialized payload including its encapsulation header, return false if it is not supported
+    bool reset(const uint8_t* payload, uint32_t length);
+
+    // Attach a sample taken with take_next_sample_original
+    bool reset(DDS::OriginalData& data)
+    {
+        return reset(data.getDataPtr(), data.getDataLength());
+    }
+
+    // Attach a payload such as the raw data of a DynamicData created with deserialization disabled
+    bool reset(const std::shared_ptr<greenstone::dds::SerializedPayload_t>& payload)
+    {
+        return (payload != nullptr) ? reset(payload->value(), payload->length()) : reset(nullptr, 0);
+    }
+
+    // Get the field of a member of the type, -1 if the member is a struct or not found
+    int32_t get_field(const greenstone::dds::MemberId id) const;
+
+    // Get the field by its dotted name, -1 if not found
+    int32_t get_field(const std::string& name) const
+    {
+        return m_layout ? m_layout->find_field(name) : -1;
+    }
+
+    // Getters of primitive fields, the kind of the field must match
+    greenstone::dds::ReturnCode_t get_bool_value(bool& value, uint32_t field)
+    {
+        uint8_t octet = 0;
+        greenstone::dds::ReturnCode_t ret = read(octet, field, greenstone::dds::TK_BOOLEAN);
+        value = (octet != 0);
+        return ret;
+    }
+
+    greenstone::dds::ReturnCode_t get_byte_value(uint8_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_BYTE);
+    }
+
+    greenstone::dds::ReturnCode_t get_int8_value(int8_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_INT8);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint8_value(uint8_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_UINT8);
+    }
+
+    greenstone::dds::ReturnCode_t get_char8_value(char& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_CHAR8);
+    }
+
+    greenstone::dds::ReturnCode_t get_int16_value(int16_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_INT16);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint16_value(uint16_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_UINT16);
+    }
+
+    greenstone::dds::ReturnCode_t get_int32_value(int32_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_INT32);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint32_value(uint32_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_UINT32);
+    }
+
+    greenstone::dds::ReturnCode_t get_int64_value(int64_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_INT64);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint64_value(uint64_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_UINT64);
+    }
+
+    greenstone::dds::ReturnCode_t get_float32_value(float& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_FLOAT32);
+    }
+
+    greenstone::dds::ReturnCode_t get_float64_value(double& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_FLOAT64);
+    }
+
+    greenstone::dds::ReturnCode_t get_enumeration_value(uint32_t& value, uint32_t field)
+    {
+        return read(value, field, greenstone::dds::TK_ENUM);
+    }
+
+    // Get a string field without copying, data points into the payload and is not NUL terminated
+    greenstone::dds::ReturnCode_t get_string_view(const char*& data, uint32_t& length, uint32_t field);
+
+    // Get a string field
+    greenstone::dds::ReturnCode_t get_string_value(std::string& value, uint32_t field);
+
+    // Get the number of elements of an array or sequence field
+    greenstone::dds::ReturnCode_t get_item_count(uint32_t& count, uint32_t field);
+
+    // Bulk getters of array and sequence fields, copying all elements in one call. The element kind must match,
+    // booleans are returned as one octet per element
+    greenstone::dds::ReturnCode_t get_bool_values(std::vector<uint8_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_BOOLEAN);
+    }
+
+    greenstone::dds::ReturnCode_t get_byte_values(std::vector<uint8_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_BYTE);
+    }
+
+    greenstone::dds::ReturnCode_t get_int8_values(std::vector<int8_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_INT8);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint8_values(std::vector<uint8_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_UINT8);
+    }
+
+    greenstone::dds::ReturnCode_t get_char8_values(std::vector<char>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_CHAR8);
+    }
+
+    greenstone::dds::ReturnCode_t get_int16_values(std::vector<int16_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_INT16);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint16_values(std::vector<uint16_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_UINT16);
+    }
+
+    greenstone::dds::ReturnCode_t get_int32_values(std::vector<int32_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_INT32);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint32_values(std::vector<uint32_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_UINT32);
+    }
+
+    greenstone::dds::ReturnCode_t get_int64_values(std::vector<int64_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_INT64);
+    }
+
+    greenstone::dds::ReturnCode_t get_uint64_values(std::vector<uint64_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_UINT64);
+    }
+
+    greenstone::dds::ReturnCode_t get_float32_values(std::vector<float>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_FLOAT32);
+    }
+
+    greenstone::dds::ReturnCode_t get_float64_values(std::vector<double>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_FLOAT64);
+    }
+
+    greenstone::dds::ReturnCode_t get_enumeration_values(std::vector<uint32_t>& values, uint32_t field)
+    {
+        return read_values(values, field, greenstone::dds::TK_ENUM);
+    }
+
+    // Get the elements of an array or sequence field without copying, values points into the payload. The element
+    // size must match. Return RETCODE_PRECONDITION_NOT_MET if the byte order of the payload differs from the host
+    // or the elements are not aligned in memory, the bulk getters must be used then
+    template<typename T>
+    greenstone::dds::ReturnCode_t get_values_view(const T*& values, uint32_t& count, uint32_t field)
+    {
+        if (!m_layout || (field >= m_layout->fields().size()) || (m_layout->fields()[field].size != sizeof(T)))
+        {
+            return greenstone::dds::ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        uint32_t offset = 0;
+        greenstone::dds::ReturnCode_t ret = locate_elements(field, offset, count);
+        if (ret != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            return ret;
+        }
+        const uint8_t* data = m_payload.data + offset;
+        if (m_payload.swap || (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0))
+        {
+            return greenstone::dds::ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+        values = reinterpret_cast<const T*>(data);
+        return greenstone::dds::ReturnCode_t::RETCODE_OK;
+    }
+
+private:
+    // Locate a field of the attached payload, return its offset or -1
+    int64_t offset_of(uint32_t field);
+
+    // Locate the first element and the number of elements of an array or sequence field
+    greenstone::dds::ReturnCode_t locate_elements(uint32_t field, uint32_t& offset, uint32_t& count);
+
+    // Read all elements of an array or sequence field of the given element kind
+    template<typename T>
+    greenstone::dds::ReturnCode_t read_values(std::vector<T>& values, uint32_t field, greenstone::dds::TypeKind kind)
+    {
+        if (!m_layout || (field >= m_layout->fields().size()) || (m_layout->fields()[field].kind != kind))
+        {
+            return greenstone::dds::ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        uint32_t offset = 0;
+        uint32_t count = 0;
+        greenstone::dds::ReturnCode_t ret = locate_elements(field, offset, count);
+        if (ret != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            return ret;
+        }
+        values.resize(count);
+        if (count > 0)
+        {
+            CdrLayout::read_elements(m_payload, offset, values.data(), count, sizeof(T));
+        }
+        return greenstone::dds::ReturnCode_t::RETCODE_OK;
+    }
+
+    // Read a primitive field of the given kind
+    template<typename T>
+    greenstone::dds::ReturnCode_t read(T& value, uint32_t field, greenstone::dds::TypeKind kind)
+    {
+        if (!m_layout || (field >= m_layout->fields().size()) || (m_layout->fields()[field].kind != kind) ||
+            (m_layout->fields()[field].fieldClass != CdrLayout::FieldClass::PRIMITIVE))
+        {
+            return greenstone::dds::ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        int64_t offset = offset_of(field);
+        if ((offset < 0) || (static_cast<uint64_t>(offset) + sizeof(T) > m_payload.length))
+        {
+            return greenstone::dds::ReturnCode_t::RETCODE_NO_DATA;
+        }
+        value = CdrLayout::read<T>(m_payload, static_cast<uint32_t>(offset));
+        return greenstone::dds::ReturnCode_t::RETCODE_OK;
+    }
+
+    // Layout shared by all views of the type
+    std::shared_ptr<const CdrLayout> m_layout;
+
+    // Fields of the top-level members by MemberId, -1 for members that are not fields. MemberIds may be set
+    // with @id and be sparse, so they are not used as indexes
+    std::map<greenstone::dds::MemberId, int32_t> m_memberFields;
+
+    // Attached payload and the offsets of the fields located so far
+    CdrPayload m_payload;
+    std::vector<uint32_t> m_offsets;
+    uint32_t m_located {0};
+};
+
+#endif // CDR_VIEW_H
@@ -5,6 +5,12 @@
 **************************************************************/
 
 #include "ConfigParser.h"
+#include "NumaBinding.h"
+
+#include <cerrno>
+#include <cstring>
+#include <malloc.h>
+#include <sys/mman.h>
 
 namespace {
     const std::map<std::string, greenstone::dds::DurabilityQosPolicyKind> DURABILITY_QOS_POLICY_MAP = {
@@ -146,6 +152,8 @@ ParticipantQosPtr ConfigParser::get_participant_qos_from_json(const char* partic
             greenstone::dds::RecvMode_t::AsyncRecvMode, jSub, RECV_MODE_MAP, "RecvMode", "recv_sync"));
     participantAttr.used_wlp(get_bool(false, jSub, "useWLP"));
     participantAttr.enable_monitoring(get_bool(false, jSub, "enable_monitoring"));
+    // TypeObjects are only built and exchanged for type matching when xtypes is used, keep the library default otherwise
+    participantAttr.use_xtypes(get_bool(participantAttr.use_xtypes(), jSub, "use_xtypes"));
     // participantAttr.spdp_attributes().domain_tag(get_string("DefaultTag", jSub, "domain_tag"));
     
     sedpAttr.heartbeat_period(get_duration(greenstone::dds::Duration_t(2000), jSub, "heartbeat_period"));
@@ -160,7 +168,8 @@ ParticipantQosPtr ConfigParser::get_participant_qos_from_json(const char* partic
     participantQos->user_data(userData);
     if (jSub.contains("enable_security") && jSub["enable_security"].get<bool>())
     {
-        set_security_qos(participantQos);
+        json jSecurity = jSub.contains("security") ? jSub["security"] : json::object();
+        set_security_qos(participantQos, jSecurity);
     }
 
     return participantQos;
@@ -290,6 +299,7 @@ WriterQosPtr ConfigParser::get_writer_qos_from_json(const char* writerConfigName
     flow_ctrl.period(
         get_number<uint32_t>(0U, jSub, "flow_ctrl", "period")
     );
+    writerQos->flow_control(flow_ctrl);
 
     greenstone::dds::OwnershipQosPolicy ownership;
     ownership.kind(
@@ -469,6 +479,15 @@ ReaderQosPtr ConfigParser::get_reader_qos_from_json(const char* readerConfigName
             RELIABILITY_QOS_POLICY_MAP, "Reliability", "reliability", "kind"));
     readerQos->reliability(reliability);
 
+    greenstone::dds::FlowControlQosPolicy flow_ctrl;
+    flow_ctrl.limits(
+        get_number<uint32_t>(0U, jSub, "flow_ctrl", "limits")
+    );
+    flow_ctrl.period(
+        get_number<uint32_t>(0U, jSub, "flow_ctrl", "period")
+    );
+    readerQos->flow_control(flow_ctrl);
+
     greenstone::dds::OwnershipQosPolicy ownership;
     ownership.kind(
         get_enum<greenstone::dds::OwnershipQosPolicyKind>(
@@ -570,6 +589,8 @@ ReaderQosPtr ConfigParser::get_reader_qos_from_json(const char* readerConfigName
         get_duration(greenstone::dds::Duration_t(1), jSub, "attributes", "heartbeat_suppression_duration"));
     datareaderAttr.ack_with_data_per_seq_num(
         get_number<uint32_t>(10, jSub, "attributes", "ack_with_data_per_seq_num"));
+    // Largest fragment the reader asks its writers to send, 0 leaves it to their max_frag_size
+    datareaderAttr.recv_max_frag_size(get_number<uint32_t>(0, jSub, "attributes", "recv_max_frag_size"));
 
     readerQos->attributes(datareaderAttr);
 
@@ -612,10 +633,37 @@ greenstone::dds::DomainParticipant* ConfigParser::get_participant_from_json(
     greenstone::dds::DomainParticipantFactory::get_instance()->set_qos(domainParticipantFactoryQos);
     
     ParticipantQosPtr participantQos = get_participant_qos_from_json(participantConfigName);
+    if (participantQos == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto jSub = m_j["domain_participant_qos"][participantConfigName];
+    if (jSub.contains("preallocate") && !preallocate_memory(jSub["preallocate"]))
+    {
+        return nullptr;
+    }
+
+    // The threads of the participant and the memory they touch first are placed on the node of the thread creating it
+    int32_t numaNode = get_number<int32_t>(-1, jSub, "numa_node");
+    NumaBinding binding(numaNode);
+    if ((numaNode >= 0) && !binding.is_bound())
+    {
+        return nullptr;
+    }
     greenstone::dds::DomainParticipant* dpPtr = 
         greenstone::dds::DomainParticipantFactory::get_instance()->create_participant(
             participantQos->rtps_participant_attributes().spdp_attributes().domain_id(), 
             *participantQos, listener, mask);
+    if (dpPtr != nullptr)
+    {
+        m_participantConfigs[dpPtr] = participantConfigName;
+    }
+    if ((dpPtr != nullptr) && binding.is_bound())
+    {
+        std::cout << participantConfigName << " created on NUMA node " << numaNode << ", "
+                  << NumaBinding::get_placement() << std::endl;
+    }
     return dpPtr;
 }
 
@@ -649,6 +697,25 @@ greenstone::dds::DataWriter* ConfigParser::get_writer_from_json(
     const greenstone::dds::StatusMask& mask)
 {
     WriterQosPtr writerQos = get_writer_qos_from_json(writerConfigName);
+    if ((writerQos == nullptr) ||
+        !check_resource_limits(writerConfigName, publisher->get_participant(),
+            writerQos->resource_limits(), writerQos->history()))
+    {
+        return nullptr;
+    }
+    int32_t numaNode = get_number<int32_t>(-1, m_j["writer_qos"][writerConfigName], "numa_node");
+    NumaBinding binding(numaNode);
+    if ((numaNode >= 0) && !binding.is_bound())
+    {
+        return nullptr;
+    }
+    // Without group send the writer sends a copy to every matched reader, even readers behind the same locator or
+    // multicast group
+    if (!writerQos->attributes().enable_group_send() && has_multicast_list(publisher->get_participant()))
+    {
+        std::cout << "Writer " << writerConfigName << " sends a copy of each sample to every matched reader, "
+                  << "set enableGroupSend in its attributes to send one per multicast group and locator" << std::endl;
+    }
     greenstone::dds::DataWriter* writerPtr = publisher->create_datawriter(topic, *writerQos, listener, mask);
     return writerPtr;
 }
@@ -661,6 +728,18 @@ greenstone::dds::DataReader* ConfigParser::get_reader_from_json(
     const greenstone::dds::StatusMask& mask)
 {
     ReaderQosPtr readerQos = get_reader_qos_from_json(readerConfigName);
+    if ((readerQos == nullptr) ||
+        !check_resource_limits(readerConfigName, subscriber->get_participant(),
+            readerQos->resource_limits(), readerQos->history()))
+    {
+        return nullptr;
+    }
+    int32_t numaNode = get_number<int32_t>(-1, m_j["reader_qos"][readerConfigName], "numa_node");
+    NumaBinding binding(numaNode);
+    if ((numaNode >= 0) && !binding.is_bound())
+    {
+        return nullptr;
+    }
     greenstone::dds::DataReader* readerPtr = subscriber->create_datareader(topic, *readerQos, listener, mask);
     return readerPtr;
 }
@@ -679,6 +758,117 @@ greenstone::dds::Topic* ConfigParser::get_topic_from_json(
     return topicPtr;
 }
 
+bool ConfigParser::check_resource_limits(
+    const char* configName,
+    greenstone::dds::DomainParticipant* domainParticipant,
+    const greenstone::dds::ResourceLimitsQosPolicy& resourceLimits,
+    const greenstone::dds::HistoryQosPolicy& history)
+{
+    // The DataWriter and DataReader refuse a max_samples_per_instance of 0 or above max_samples, and with
+    // KEEP_LAST_HISTORY_QOS a depth below 1, above max_samples_per_instance or with either of them unlimited,
+    // without telling why, so these are reported before creating. A max_samples or max_instances of 0 is
+    // accepted by them and left to them
+    gint32_t maxSamples = resourceLimits.max_samples();
+    gint32_t maxInstances = resourceLimits.max_instances();
+    gint32_t maxSamplesPerInstance = resourceLimits.max_samples_per_instance();
+    std::string reason;
+    if (maxSamplesPerInstance == 0)
+    {
+        reason = "max_samples_per_instance must not be 0";
+    }
+    else if (get_participant_config(domainParticipant).contains("preallocate") &&
+        ((maxSamples < 0) || (maxInstances < 0) || (maxSamplesPerInstance < 0)))
+    {
+        reason = "resource_limits must be finite when the participant preallocates the memory";
+    }
+    else if ((maxSamples > 0) && (maxSamplesPerInstance > maxSamples))
+    {
+        reason = "max_samples_per_instance " + std::to_string(maxSamplesPerInstance) +
+            " is greater than max_samples " + std::to_string(maxSamples);
+    }
+    else if (history.kind() == greenstone::dds::HistoryQosPolicyKind::KEEP_LAST_HISTORY_QOS)
+    {
+        if (history.depth() < 1)
+        {
+            reason = "history depth must be at least 1 with KEEP_LAST_HISTORY_QOS";
+        }
+        else if ((maxSamples < 0) || (maxSamplesPerInstance < 0))
+        {
+            reason = "max_samples and max_samples_per_instance must be finite with KEEP_LAST_HISTORY_QOS";
+        }
+        else if ((maxSamplesPerInstance > 0) && (history.depth() > maxSamplesPerInstance))
+        {
+            reason = "history depth " + std::to_string(history.depth()) +
+                " is greater than max_samples_per_instance " + std::to_string(maxSamplesPerInstance);
+        }
+    }
+
+    if (!reason.empty())
+    {
+        std::cout << "Invalid resource_limits in " << configName << ": " << reason << std::endl;
+        return false;
+    }
+    return true;
+}
+
+json ConfigParser::get_participant_config(greenstone::dds::DomainParticipant* domainParticipant)
+{
+    auto it = m_participantConfigs.find(domainParticipant);
+    if ((it == m_participantConfigs.end()) || !m_j.contains("domain_participant_qos") ||
+        !m_j["domain_participant_qos"].contains(it->second))
+    {
+        return json::object();
+    }
+    return m_j["domain_participant_qos"][it->second];
+}
+
+bool ConfigParser::has_multicast_list(greenstone::dds::DomainParticipant* domainParticipant)
+{
+    json jParticipant = get_participant_config(domainParticipant);
+    return jParticipant.contains("multicast_list") && !jParticipant["multicast_list"].empty();
+}
+
+bool ConfigParser::preallocate_memory(json& jPreallocate)
+{
+    // The heap is reserved once per process, for the first participant configured with it
+    if (m_preallocated)
+    {
+        return true;
+    }
+
+    size_t heapSize = get_number<size_t>(64 * 1024 * 1024, jPreallocate, "heap_size");
+    bool lockMemory = get_bool(false, jPreallocate, "lock_memory");
+
+    // Keep every allocation in the heap and never give freed memory back to the system, so that the pages
+    // touched below are reused instead of being mapped and faulted in again while samples are written. The
+    // threads of the DDS entities are held to the main arena as well, which is the only one prefaulted here
+    if ((mallopt(M_ARENA_MAX, 1) != 1) || (mallopt(M_MMAP_MAX, 0) != 1) ||
+        (mallopt(M_TRIM_THRESHOLD, -1) != 1))
+    {
+        std::cout << "Failed to configure malloc for preallocation" << std::endl;
+        return false;
+    }
+
+    void* heap = malloc(heapSize);
+    if (heap == nullptr)
+    {
+        std::cout << "Failed to preallocate " << heapSize << " bytes of heap" << std::endl;
+        return false;
+    }
+    memset(heap, 0, heapSize);
+    free(heap);
+
+    if (lockMemory && (mlockall(MCL_CURRENT | MCL_FUTURE) != 0))
+    {
+        std::cout << "Failed to lock memory: " << strerror(errno)
+                  << ", check the limit of locked memory with ulimit -l" << std::endl;
+        return false;
+    }
+
+    m_preallocated = true;
+    return true;
+}
+
 greenstone::dds::Locator_t ConfigParser::get_locator_from_address(const std::string& addr)
 {
     gint32_t kind;
@@ -936,23 +1126,32 @@ std::array<T, 100> ConfigParser::get_number_sequence(
     return tempArray;
 }
 
-void ConfigParser::set_security_qos(ParticipantQosPtr qos)
+void ConfigParser::set_security_qos(ParticipantQosPtr qos, json& jSecurity)
 {
-    // Configure Authentication
     greenstone::dds::PropertyQosPolicy propertyQos = qos->property();
-    gstone::PropertySeq propertySeq = propertyQos.value();
-    propertySeq.emplace_back("dds.sec.auth.plugin", "builtin.PKI-DH");
-    propertySeq.emplace_back("dds.sec.auth.identity_ca", "file:../../certs1/maincacert.pem");
-    propertySeq.emplace_back("dds.sec.auth.identity_certificate", "file:../../certs1/partcert.pem");
-    propertySeq.emplace_back("dds.sec.auth.private_key", "file:../../certs1/partkey.pem");
-    propertySeq.emplace_back("dds.sec.auth.password", ""); // password is ignored if private key is set
+
+    // Configure Authentication
+    propertyQos.add_property(gstone::Property("dds.sec.auth.plugin", "builtin.PKI-DH"));
+    propertyQos.add_property(gstone::Property("dds.sec.auth.identity_ca",
+        get_string("file:../../certs1/maincacert.pem", jSecurity, "identity_ca")));
+    propertyQos.add_property(gstone::Property("dds.sec.auth.identity_certificate",
+        get_string("file:../../certs1/partcert.pem", jSecurity, "identity_certificate")));
+    propertyQos.add_property(gstone::Property("dds.sec.auth.private_key",
+        get_string("file:../../certs1/partkey.pem", jSecurity, "private_key")));
+    // password is ignored if private key is set
+    propertyQos.add_property(gstone::Property("dds.sec.auth.password", get_string("", jSecurity, "password")));
 
     // Configure Access Control
-    propertySeq.emplace_back("dds.sec.access.plugin", "builtin.Access-Permissions");
-    propertySeq.emplace_back("dds.sec.access.permissions_ca", "file:../../certs1/maincacert.pem");
-    propertySeq.emplace_back("dds.sec.access.governance", "file:../../certs1/governance.smime");
-    propertySeq.emplace_back("dds.sec.access.permissions", "file:../../certs1/permissions.smime");
+    propertyQos.add_property(gstone::Property("dds.sec.access.plugin", "builtin.Access-Permissions"));
+    propertyQos.add_property(gstone::Property("dds.sec.access.permissions_ca",
+        get_string("file:../../certs1/maincacert.pem", jSecurity, "permissions_ca")));
+    propertyQos.add_property(gstone::Property("dds.sec.access.governance",
+        get_string("file:../../certs1/governance.smime", jSecurity, "governance")));
+    propertyQos.add_property(gstone::Property("dds.sec.access.permissions",
+        get_string("file:../../certs1/permissions.smime", jSecurity, "permissions")));
 
     // Configure Cryptography
-    propertySeq.emplace_back("dds.sec.crypto.plugin", "builtin.AES-GCM_GMAC");
+    propertyQos.add_property(gstone::Property("dds.sec.crypto.plugin", "builtin.AES-GCM_GMAC"));
+
+    qos->property(propertyQos);
 }
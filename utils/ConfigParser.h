@@ -9,6 +9,7 @@
 
 #include <vector>
 #include <list>
+#include <map>
 #include <fstream>
 #include "json.hpp"
 #include "swiftdds/dcps/SwiftDdsExport.h"
@@ -185,12 +186,33 @@ private:
         const std::string& key1, 
         const std::string& key2 = "");
 
-    // Set DDS Security from json
-    void set_security_qos(ParticipantQosPtr qos);
+    // Set DDS Security from json, with the certificates and governance documents given in jSecurity
+    void set_security_qos(ParticipantQosPtr qos, json& jSecurity);
+
+    // Check that the resource limits can hold the history before creating a writer or reader with them under
+    // the participant
+    bool check_resource_limits(
+        const char* configName,
+        greenstone::dds::DomainParticipant* domainParticipant,
+        const greenstone::dds::ResourceLimitsQosPolicy& resourceLimits,
+        const greenstone::dds::HistoryQosPolicy& history);
+
+    // Reserve and prefault the heap of the process, and lock it in memory if required
+    bool preallocate_memory(json& jPreallocate);
+
+    // Get the participant configuration the participant was created from, empty if it is unknown
+    json get_participant_config(greenstone::dds::DomainParticipant* domainParticipant);
+
+    // Check whether the participant configuration the participant was created from receives on a multicast group
+    bool has_multicast_list(greenstone::dds::DomainParticipant* domainParticipant);
 
 private:
     json m_j;
     bool m_initialized {false};
+    // Set once the heap has been preallocated, which is done once per process
+    bool m_preallocated {false};
+    // The configuration each participant was created from
+    std::map<greenstone::dds::DomainParticipant*, std::string> m_participantConfigs;
 
     DECLARE_CONFIG_SINGLETON(ConfigParser)
 };
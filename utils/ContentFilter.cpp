@@ -0,0 +1,559 @@
+/**************************************************************
+* @file ContentFilter.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <limits>
+#include "ContentFilter.h"
+
+namespace {
+    std::string to_upper(std::string text)
+    {
+        std::transform(text.begin(), text.end(), text.begin(),
+            [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+        return text;
+    }
+
+    // Strip the quotes of a string parameter such as 'abc'
+    std::string unquote(const std::string& text)
+    {
+        if ((text.size() >= 2) && (text.front() == '\'') && (text.back() == '\''))
+        {
+            return text.substr(1, text.size() - 2);
+        }
+        return text;
+    }
+
+    template<typename T>
+    bool apply(T lhs, T rhs, int comparator)
+    {
+        switch (comparator)
+        {
+            case 0: return lhs == rhs;
+            case 1: return lhs != rhs;
+            case 2: return lhs < rhs;
+            case 3: return lhs <= rhs;
+            case 4: return lhs > rhs;
+            default: return lhs >= rhs;
+        }
+    }
+}
+
+bool ContentFilter::compile(
+    const greenstone::dds::DynamicType_ptr& type,
+    const std::string& expression,
+    const greenstone::dds::StringSeq& parameters)
+{
+    m_nodes.clear();
+    m_root = -1;
+    m_lastField = 0;
+    m_allFixed = true;
+    m_error.clear();
+
+    if (!m_layout.build(type))
+    {
+        m_error = "Type of the filter is not a struct";
+        return false;
+    }
+    if (!tokenize(expression))
+    {
+        return false;
+    }
+
+    m_position = 0;
+    int32_t root = parse_or();
+    if ((root >= 0) && (m_tokens[m_position].type != Token::Type::END))
+    {
+        m_error = "Unexpected token '" + m_tokens[m_position].text + "'";
+        root = -1;
+    }
+    m_tokens.clear();
+    if (root < 0)
+    {
+        m_nodes.clear();
+        return false;
+    }
+
+    if (!set_parameters(parameters))
+    {
+        m_nodes.clear();
+        return false;
+    }
+    m_root = root;
+    return true;
+}
+
+bool ContentFilter::set_parameters(const greenstone::dds::StringSeq& parameters)
+{
+    // Bind all values to a copy, so that the filter is left unchanged when one of them is invalid
+    std::vector<Node> nodes = m_nodes;
+    for (Node& node : nodes)
+    {
+        if (node.kind != NodeKind::COMPARE)
+        {
+            continue;
+        }
+        if (node.parameter < 0)
+        {
+            if (!bind(node, node.literal))
+            {
+                return false;
+            }
+        }
+        else if (static_cast<size_t>(node.parameter) >= parameters.size())
+        {
+            m_error = "Missing value of parameter %" + std::to_string(node.parameter);
+            return false;
+        }
+        else if (!bind(node, unquote(parameters[node.parameter])))
+        {
+            return false;
+        }
+    }
+    m_nodes.swap(nodes);
+    return true;
+}
+
+bool ContentFilter::tokenize(const std::string& expression)
+{
+    m_tokens.clear();
+    size_t i = 0;
+    while (i < expression.size())
+    {
+        char c = expression[i];
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            ++i;
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)) || (c == '_'))
+        {
+            size_t start = i;
+            while ((i < expression.size()) &&
+                (std::isalnum(static_cast<unsigned char>(expression[i])) || (expression[i] == '_') || (expression[i] == '.')))
+            {
+                ++i;
+            }
+            std::string word = expression.substr(start, i - start);
+            std::string keyword = to_upper(word);
+            if (keyword == "AND")
+            {
+                m_tokens.push_back({Token::Type::AND, word});
+            }
+            else if (keyword == "OR")
+            {
+                m_tokens.push_back({Token::Type::OR, word});
+            }
+            else if (keyword == "NOT")
+            {
+                m_tokens.push_back({Token::Type::NOT, word});
+            }
+            else if ((keyword == "TRUE") || (keyword == "FALSE"))
+            {
+                m_tokens.push_back({Token::Type::NUMBER, (keyword == "TRUE") ? "1" : "0"});
+            }
+            else
+            {
+                m_tokens.push_back({Token::Type::IDENTIFIER, word});
+            }
+        }
+        else if (std::isdigit(static_cast<unsigned char>(c)) || (c == '-') || (c == '+') || (c == '.'))
+        {
+            size_t start = i++;
+            while ((i < expression.size()) && (std::isalnum(static_cast<unsigned char>(expression[i])) ||
+                (expression[i] == '.') || (((expression[i] == '-') || (expression[i] == '+')) &&
+                ((expression[i - 1] == 'e') || (expression[i - 1] == 'E')))))
+            {
+                ++i;
+            }
+            m_tokens.push_back({Token::Type::NUMBER, expression.substr(start, i - start)});
+        }
+        else if (c == '\'')
+        {
+            size_t end = expression.find('\'', i + 1);
+            if (end == std::string::npos)
+            {
+                m_error = "Unterminated string literal";
+                return false;
+            }
+            m_tokens.push_back({Token::Type::STRING, expression.substr(i + 1, end - i - 1)});
+            i = end + 1;
+        }
+        else if (c == '%')
+        {
+            size_t start = ++i;
+            while ((i < expression.size()) && std::isdigit(static_cast<unsigned char>(expression[i])))
+            {
+                ++i;
+            }
+            if (i == start)
+            {
+                m_error = "Parameter index is missed after '%'";
+                return false;
+            }
+            m_tokens.push_back({Token::Type::PARAMETER, expression.substr(start, i - start)});
+        }
+        else if ((c == '=') || (c == '<') || (c == '>') || (c == '!'))
+        {
+            size_t length = ((i + 1 < expression.size()) &&
+                ((expression[i + 1] == '=') || ((c == '<') && (expression[i + 1] == '>')))) ? 2 : 1;
+            std::string op = expression.substr(i, length);
+            if (op == "!")
+            {
+                m_error = "Unknown operator '!'";
+                return false;
+            }
+            m_tokens.push_back({Token::Type::COMPARATOR, op});
+            i += length;
+        }
+        else if (c == '(')
+        {
+            m_tokens.push_back({Token::Type::LEFT_PAREN, "("});
+            ++i;
+        }
+        else if (c == ')')
+        {
+            m_tokens.push_back({Token::Type::RIGHT_PAREN, ")"});
+            ++i;
+        }
+        else
+        {
+            m_error = std::string("Unexpected character '") + c + "'";
+            return false;
+        }
+    }
+    m_tokens.push_back({Token::Type::END, "end of expression"});
+    return true;
+}
+
+int32_t ContentFilter::parse_or()
+{
+    int32_t left = parse_and();
+    while ((left >= 0) && (m_tokens[m_position].type == Token::Type::OR))
+    {
+        ++m_position;
+        int32_t right = parse_and();
+        if (right < 0)
+        {
+            return -1;
+        }
+        Node node;
+        node.kind = NodeKind::OR;
+        node.left = left;
+        node.right = right;
+        m_nodes.push_back(node);
+        left = static_cast<int32_t>(m_nodes.size() - 1);
+    }
+    return left;
+}
+
+int32_t ContentFilter::parse_and()
+{
+    int32_t left = parse_unary();
+    while ((left >= 0) && (m_tokens[m_position].type == Token::Type::AND))
+    {
+        ++m_position;
+        int32_t right = parse_unary();
+        if (right < 0)
+        {
+            return -1;
+        }
+        Node node;
+        node.kind = NodeKind::AND;
+        node.left = left;
+        node.right = right;
+        m_nodes.push_back(node);
+        left = static_cast<int32_t>(m_nodes.size() - 1);
+    }
+    return left;
+}
+
+int32_t ContentFilter::parse_unary()
+{
+    if (m_tokens[m_position].type == Token::Type::NOT)
+    {
+        ++m_position;
+        int32_t operand = parse_unary();
+        if (operand < 0)
+        {
+            return -1;
+        }
+        Node node;
+        node.kind = NodeKind::NOT;
+        node.left = operand;
+        m_nodes.push_back(node);
+        return static_cast<int32_t>(m_nodes.size() - 1);
+    }
+
+    if (m_tokens[m_position].type == Token::Type::LEFT_PAREN)
+    {
+        ++m_position;
+        int32_t inner = parse_or();
+        if (inner < 0)
+        {
+            return -1;
+        }
+        if (m_tokens[m_position].type != Token::Type::RIGHT_PAREN)
+        {
+            m_error = "Missing ')' before '" + m_tokens[m_position].text + "'";
+            return -1;
+        }
+        ++m_position;
+        return inner;
+    }
+
+    return parse_comparison();
+}
+
+int32_t ContentFilter::parse_comparison()
+{
+    // Accept both "field op value" and "value op field"
+    const Token* fieldToken = &m_tokens[m_position];
+    const Token* opToken = &m_tokens[m_position + ((fieldToken->type == Token::Type::END) ? 0 : 1)];
+    const Token* valueToken = nullptr;
+    bool reversed = false;
+
+    if (opToken->type != Token::Type::COMPARATOR)
+    {
+        m_error = "Comparison expected at '" + fieldToken->text + "'";
+        return -1;
+    }
+    valueToken = &m_tokens[m_position + 2];
+    if ((fieldToken->type != Token::Type::IDENTIFIER) && (valueToken->type == Token::Type::IDENTIFIER))
+    {
+        std::swap(fieldToken, valueToken);
+        reversed = true;
+    }
+    if ((fieldToken->type != Token::Type::IDENTIFIER) ||
+        ((valueToken->type != Token::Type::NUMBER) && (valueToken->type != Token::Type::STRING) &&
+        (valueToken->type != Token::Type::PARAMETER)))
+    {
+        m_error = "Comparison between a field and a value expected at '" + m_tokens[m_position].text + "'";
+        return -1;
+    }
+
+    Node node;
+    node.kind = NodeKind::COMPARE;
+
+    int32_t field = m_layout.find_field(fieldToken->text);
+    if (field < 0)
+    {
+        m_error = "Unknown field '" + fieldToken->text + "'";
+        return -1;
+    }
+    const CdrLayout::Field& layoutField = m_layout.fields()[field];
+    if ((static_cast<uint32_t>(field) >= m_layout.reachable_fields()) ||
+        ((layoutField.fieldClass != CdrLayout::FieldClass::PRIMITIVE) &&
+        (layoutField.fieldClass != CdrLayout::FieldClass::STRING)) ||
+        (layoutField.kind == greenstone::dds::TK_FLOAT128))
+    {
+        m_error = "Field '" + fieldToken->text + "' cannot be used in a filter";
+        return -1;
+    }
+    node.field = static_cast<uint32_t>(field);
+    m_lastField = (std::max)(m_lastField, node.field);
+    m_allFixed = m_allFixed && (layoutField.fixedOffset >= 0);
+
+    switch (layoutField.kind)
+    {
+        case greenstone::dds::TK_INT8:
+        case greenstone::dds::TK_INT16:
+        case greenstone::dds::TK_INT32:
+        case greenstone::dds::TK_INT64:
+        case greenstone::dds::TK_ENUM:
+            node.valueClass = ValueClass::SIGNED;
+            break;
+        case greenstone::dds::TK_FLOAT32:
+        case greenstone::dds::TK_FLOAT64:
+            node.valueClass = ValueClass::FLOAT;
+            break;
+        case greenstone::dds::TK_STRING8:
+            node.valueClass = ValueClass::STRING;
+            break;
+        default:
+            node.valueClass = ValueClass::UNSIGNED;
+            break;
+    }
+
+    const std::string& op = opToken->text;
+    if (op == "=")
+    {
+        node.comparator = Comparator::EQ;
+    }
+    else if ((op == "<>") || (op == "!="))
+    {
+        node.comparator = Comparator::NE;
+    }
+    else if (op == "<")
+    {
+        node.comparator = reversed ? Comparator::GT : Comparator::LT;
+    }
+    else if (op == "<=")
+    {
+        node.comparator = reversed ? Comparator::GE : Comparator::LE;
+    }
+    else if (op == ">")
+    {
+        node.comparator = reversed ? Comparator::LT : Comparator::GT;
+    }
+    else if (op == ">=")
+    {
+        node.comparator = reversed ? Comparator::LE : Comparator::GE;
+    }
+    else
+    {
+        m_error = "Unknown operator '" + op + "'";
+        return -1;
+    }
+
+    if (valueToken->type == Token::Type::PARAMETER)
+    {
+        node.parameter = std::atoi(valueToken->text.c_str());
+    }
+    else
+    {
+        node.literal = valueToken->text;
+    }
+
+    m_position += 3;
+    m_nodes.push_back(node);
+    return static_cast<int32_t>(m_nodes.size() - 1);
+}
+
+bool ContentFilter::bind(Node& node, const std::string& text)
+{
+    const CdrLayout::Field& field = m_layout.fields()[node.field];
+    char* end = nullptr;
+
+    switch (node.valueClass)
+    {
+        case ValueClass::SIGNED:
+            node.signedValue = std::strtoll(text.c_str(), &end, 0);
+            break;
+        case ValueClass::UNSIGNED:
+            if ((field.kind == greenstone::dds::TK_CHAR8) && (text.size() == 1) && !std::isdigit(static_cast<unsigned char>(text[0])))
+            {
+                node.unsignedValue = static_cast<uint8_t>(text[0]);
+                return true;
+            }
+            node.unsignedValue = std::strtoull(text.c_str(), &end, 0);
+            break;
+        case ValueClass::FLOAT:
+            node.floatValue = std::strtod(text.c_str(), &end);
+            if ((field.kind == greenstone::dds::TK_FLOAT32) &&
+                (std::fabs(node.floatValue) <= (std::numeric_limits<float>::max)()))
+            {
+                // Round to the float the field holds, 0.1 would never equal a float field set to 0.1f otherwise
+                node.floatValue = static_cast<float>(node.floatValue);
+            }
+            break;
+        default:
+            node.stringValue = text;
+            return true;
+    }
+
+    if (text.empty() || (end == nullptr) || (*end != '\0'))
+    {
+        m_error = "Value '" + text + "' does not match the type of field '" + field.name + "'";
+        return false;
+    }
+    return true;
+}
+
+bool ContentFilter::evaluate(const uint8_t* payload, uint32_t length) const
+{
+    // Nothing passes a filter that failed to compile
+    if (m_root < 0)
+    {
+        return false;
+    }
+
+    CdrPayload cdr(payload, length);
+    if (!cdr.valid)
+    {
+        return true;
+    }
+
+    // Variable-length fields are only walked up to the last field the expression needs
+    if (!m_allFixed && (m_layout.locate(cdr, m_lastField, m_offsets) <= m_lastField))
+    {
+        return false;
+    }
+    return evaluate_node(cdr, m_root);
+}
+
+bool ContentFilter::evaluate_node(const CdrPayload& payload, int32_t index) const
+{
+    const Node& node = m_nodes[index];
+    switch (node.kind)
+    {
+        case NodeKind::AND:
+            return evaluate_node(payload, node.left) && evaluate_node(payload, node.right);
+        case NodeKind::OR:
+            return evaluate_node(payload, node.left) || evaluate_node(payload, node.right);
+        case NodeKind::NOT:
+            return !evaluate_node(payload, node.left);
+        default:
+            return compare(payload, node);
+    }
+}
+
+bool ContentFilter::compare(const CdrPayload& payload, const Node& node) const
+{
+    const CdrLayout::Field& field = m_layout.fields()[node.field];
+    uint32_t offset = (field.fixedOffset >= 0) ? static_cast<uint32_t>(field.fixedOffset) : m_offsets[node.field];
+    int comparator = static_cast<int>(node.comparator);
+
+    if (node.valueClass == ValueClass::STRING)
+    {
+        if (static_cast<uint64_t>(offset) + 4 > payload.length)
+        {
+            return false;
+        }
+        uint32_t length = CdrLayout::read<uint32_t>(payload, offset);
+        if (static_cast<uint64_t>(offset) + 4 + length > payload.length)
+        {
+            return false;
+        }
+        // The serialized length includes the terminating NUL
+        size_t size = (length > 0) ? length - 1 : 0;
+        int result = node.stringValue.compare(0, std::string::npos,
+            reinterpret_cast<const char*>(payload.data + offset + 4), size);
+        return apply<int>(0, result, comparator);
+    }
+
+    if (static_cast<uint64_t>(offset) + field.size > payload.length)
+    {
+        return false;
+    }
+
+    switch (field.kind)
+    {
+        case greenstone::dds::TK_INT8:
+            return apply<int64_t>(CdrLayout::read<int8_t>(payload, offset), node.signedValue, comparator);
+        case greenstone::dds::TK_INT16:
+            return apply<int64_t>(CdrLayout::read<int16_t>(payload, offset), node.signedValue, comparator);
+        case greenstone::dds::TK_INT32:
+        case greenstone::dds::TK_ENUM:
+            return apply<int64_t>(CdrLayout::read<int32_t>(payload, offset), node.signedValue, comparator);
+        case greenstone::dds::TK_INT64:
+            return apply<int64_t>(CdrLayout::read<int64_t>(payload, offset), node.signedValue, comparator);
+        case greenstone::dds::TK_UINT16:
+        case greenstone::dds::TK_CHAR16:
+            return apply<uint64_t>(CdrLayout::read<uint16_t>(payload, offset), node.unsignedValue, comparator);
+        case greenstone::dds::TK_UINT32:
+            return apply<uint64_t>(CdrLayout::read<uint32_t>(payload, offset), node.unsignedValue, comparator);
+        case greenstone::dds::TK_UINT64:
+            return apply<uint64_t>(CdrLayout::read<uint64_t>(payload, offset), node.unsignedValue, comparator);
+        case greenstone::dds::TK_FLOAT32:
+            return apply<double>(CdrLayout::read<float>(payload, offset), node.floatValue, comparator);
+        case greenstone::dds::TK_FLOAT64:
+            return apply<double>(CdrLayout::read<double>(payload, offset), node.floatValue, comparator);
+        default:
+            return apply<uint64_t>(CdrLayout::read<uint8_t>(payload, offset), node.unsignedValue, comparator);
+    }
+}
@@ -0,0 +1,161 @@
+/**************************************************************
+* @file ContentFilter.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef CONTENT_FILTER_H
+#define CONTENT_FILTER_H
+
+#include <string>
+#include <vector>
+#include "CdrLayout.h"
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class ContentFilter
+* @brief This class compiles a SQL-like filter expression, as used by QueryCondition and ContentFilteredTopic,
+*        into a tree of typed comparisons that reads fields straight from the serialized CDR payload.
+* @note The expression is parsed and resolved against the type once. Changing the parameters only converts
+*       the new values. Samples taken with take_next_sample_original can be filtered without being
+*       deserialized. Supported grammar: comparisons (=, <>, !=, <, <=, >, >=) between a primitive or
+*       string field and a literal or a parameter %n, combined with AND, OR, NOT and parentheses. Values are
+*       converted to the type of the field they are compared with, so a float field is compared with the float
+*       nearest to the value. A filter that is not compiled rejects every sample. evaluate() is not thread-safe.
+*/
+
+class ContentFilter
+{
+public:
+    ContentFilter() {}
+
+    // Compile a filter expression for a struct type, return false and set the error if it cannot be compiled
+    bool compile(
+        const greenstone::dds::DynamicType_ptr& type,
+        const std::string& expression,
+        const greenstone::dds::StringSeq& parameters);
+
+    // Bind new values to the parameters of the compiled expression, keep the previous ones if any value is invalid
+    bool set_parameters(const greenstone::dds::StringSeq& parameters);
+
+    // Evaluate the filter on a serialized payload including its encapsulation header, false if it is not compiled.
+    // Payloads in an unsupported encoding pass, so the application can still filter them after deserializing.
+    bool evaluate(const uint8_t* payload, uint32_t length) const;
+
+    // Evaluate the filter on a sample taken with take_next_sample_original
+    bool evaluate(DDS::OriginalData& data) const
+    {
+        return evaluate(data.getDataPtr(), data.getDataLength());
+    }
+
+    // Get the reason why the last compile or set_parameters failed
+    const std::string& get_error() const
+    {
+        return m_error;
+    }
+
+private:
+    enum class NodeKind
+    {
+        AND,
+        OR,
+        NOT,
+        COMPARE
+    };
+
+    enum class Comparator
+    {
+        EQ,
+        NE,
+        LT,
+        LE,
+        GT,
+        GE
+    };
+
+    enum class ValueClass
+    {
+        SIGNED,
+        UNSIGNED,
+        FLOAT,
+        STRING
+    };
+
+    // A node of the compiled expression tree, children are indexes into m_nodes
+    struct Node
+    {
+        NodeKind kind;
+        int32_t left {-1};
+        int32_t right {-1};
+
+        // Operands of COMPARE
+        uint32_t field {0};
+        Comparator comparator {Comparator::EQ};
+        ValueClass valueClass {ValueClass::SIGNED};
+        int32_t parameter {-1};
+        std::string literal;
+
+        // Constant bound from the literal or the parameter
+        int64_t signedValue {0};
+        uint64_t unsignedValue {0};
+        double floatValue {0.0};
+        std::string stringValue;
+    };
+
+    struct Token
+    {
+        enum class Type
+        {
+            IDENTIFIER,
+            NUMBER,
+            STRING,
+            PARAMETER,
+            COMPARATOR,
+            LEFT_PAREN,
+            RIGHT_PAREN,
+            AND,
+            OR,
+            NOT,
+            END
+        };
+
+        Type type;
+        std::string text;
+    };
+
+    // Split the expression into tokens
+    bool tokenize(const std::string& expression);
+
+    // Recursive descent parser, each returns the index of the node created or -1 on error
+    int32_t parse_or();
+    int32_t parse_and();
+    int32_t parse_unary();
+    int32_t parse_comparison();
+
+    // Convert the text of a literal or parameter into the constant of a COMPARE node
+    bool bind(Node& node, const std::string& text);
+
+    // Evaluate a node on a located payload
+    bool evaluate_node(const CdrPayload& payload, int32_t index) const;
+
+    // Compare a field of the payload with the constant of a COMPARE node
+    bool compare(const CdrPayload& payload, const Node& node) const;
+
+    CdrLayout m_layout;
+    std::vector<Node> m_nodes;
+    int32_t m_root {-1};
+
+    // Highest field referenced and whether all referenced fields have a fixed offset
+    uint32_t m_lastField {0};
+    bool m_allFixed {true};
+
+    // Parser state
+    std::vector<Token> m_tokens;
+    size_t m_position {0};
+    std::string m_error;
+
+    // Offsets of the fields of the payload being evaluated
+    mutable std::vector<uint32_t> m_offsets;
+};
+
+#endif // CONTENT_FILTER_H
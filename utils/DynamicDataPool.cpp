@@ -0,0 +1,85 @@
+/**************************************************************
+* @file DynamicDataPool.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "DynamicDataPool.h"
+
+DynamicDataPool::DynamicDataPool(const greenstone::dds::DynamicType_ptr& type, size_t maxIdle)
+    : m_state(std::make_shared<State>())
+{
+    m_state->type = type;
+    m_state->maxIdle = maxIdle;
+    m_state->idle.reserve(maxIdle);
+}
+
+void DynamicDataPool::preallocate(size_t count)
+{
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    while ((m_state->idle.size() < count) && (m_state->idle.size() < m_state->maxIdle))
+    {
+        greenstone::dds::DynamicData_Ptr data =
+            greenstone::dds::DynamicDataFactory::get_instance()->create_data(m_state->type);
+        if (data == nullptr)
+        {
+            break;
+        }
+        m_state->idle.push_back(data);
+        ++m_state->created;
+    }
+}
+
+greenstone::dds::DynamicData_Ptr DynamicDataPool::acquire()
+{
+    greenstone::dds::DynamicData_Ptr data;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (!m_state->idle.empty())
+        {
+            data = std::move(m_state->idle.back());
+            m_state->idle.pop_back();
+            ++m_state->reused;
+        }
+    }
+
+    if (data == nullptr)
+    {
+        data = greenstone::dds::DynamicDataFactory::get_instance()->create_data(m_state->type);
+        if (data == nullptr)
+        {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        ++m_state->created;
+    }
+
+    // The pool keeps its own reference in the deleter, the one handed out only brings it back
+    greenstone::dds::DynamicData* raw = data.get();
+    return greenstone::dds::DynamicData_Ptr(raw, Recycler {m_state, std::move(data)});
+}
+
+uint64_t DynamicDataPool::get_number_of_created() const
+{
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->created;
+}
+
+uint64_t DynamicDataPool::get_number_of_reused() const
+{
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->reused;
+}
+
+void DynamicDataPool::Recycler::operator()(greenstone::dds::DynamicData*)
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->idle.size() < state->maxIdle)
+    {
+        state->idle.push_back(std::move(data));
+    }
+    else
+    {
+        data.reset();
+    }
+}
@@ -0,0 +1,68 @@
+/**************************************************************
+* @file DynamicDataPool.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef DYNAMIC_DATA_POOL_H
+#define DYNAMIC_DATA_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class DynamicDataPool
+* @brief This class recycles the DynamicData of one type, so that receiving a dynamic sample does not create
+*        a new DynamicData with all its member nodes for every sample.
+* @note A DynamicData acquired from the pool goes back to it when the last reference to it is released, and is
+*       handed out again by the next acquire() without being cleared. It keeps the values of its previous use
+*       until a sample is deserialized into it, which overwrites all members including the length of
+*       sequences. At most maxIdle DynamicData are kept idle, the others are destroyed when released.
+*       The pool is thread-safe and may be destroyed while DynamicData acquired from it are still in use.
+*/
+
+class DynamicDataPool
+{
+public:
+    // Create a pool for samples of a type
+    explicit DynamicDataPool(const greenstone::dds::DynamicType_ptr& type, size_t maxIdle = 64);
+
+    // Create DynamicData in advance, up to the maximum number kept idle
+    void preallocate(size_t count);
+
+    // Get a DynamicData of the type, recycled if one is idle
+    greenstone::dds::DynamicData_Ptr acquire();
+
+    // Get the number of DynamicData created by the pool
+    uint64_t get_number_of_created() const;
+
+    // Get the number of DynamicData handed out again
+    uint64_t get_number_of_reused() const;
+
+private:
+    // State shared with the DynamicData handed out, which outlives the pool if needed
+    struct State
+    {
+        greenstone::dds::DynamicType_ptr type;
+        size_t maxIdle;
+        std::mutex mutex;
+        std::vector<greenstone::dds::DynamicData_Ptr> idle;
+        uint64_t created {0};
+        uint64_t reused {0};
+    };
+
+    // Deleter of the DynamicData handed out, giving it back to the pool
+    struct Recycler
+    {
+        std::shared_ptr<State> state;
+        greenstone::dds::DynamicData_Ptr data;
+
+        void operator()(greenstone::dds::DynamicData*);
+    };
+
+    std::shared_ptr<State> m_state;
+};
+
+#endif // DYNAMIC_DATA_POOL_H
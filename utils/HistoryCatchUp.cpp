@@ -0,0 +1,113 @@
+/**************************************************************
+* @file HistoryCatchUp.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "HistoryCatchUp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+    // Number of settle times the settle phase may last at most
+    const int SETTLE_LIMIT = 5;
+
+    // Pause once woken up by a sample, so that those arriving meanwhile are taken together instead of
+    // waking up the thread one by one
+    const std::chrono::microseconds BATCH_DELAY(100);
+
+    // Convert a duration of the steady clock for a wait of the WaitSet
+    greenstone::dds::Duration_t to_duration(const std::chrono::steady_clock::duration& duration)
+    {
+        int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        return greenstone::dds::Duration_t(static_cast<int32_t>(ns / 1000000000), static_cast<uint32_t>(ns % 1000000000));
+    }
+}
+
+greenstone::dds::ReturnCode_t HistoryCatchUp::run(const greenstone::dds::Duration_t& maxWait, const SampleHandler& handler)
+{
+    greenstone::dds::ReadCondition* readCondition = m_reader->create_readcondition(
+        DDS::NOT_READ_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+    if (readCondition == nullptr)
+    {
+        return greenstone::dds::ReturnCode_t::RETCODE_ERROR;
+    }
+
+    // Wake up when samples arrive or the wait for the historical data has returned
+    greenstone::dds::GuardCondition doneCondition;
+    greenstone::dds::WaitSet waitset;
+    waitset.attach_condition(readCondition);
+    waitset.attach_condition(&doneCondition);
+    greenstone::dds::ConditionSeq activeConditions;
+
+    std::atomic<bool> done {false};
+    greenstone::dds::ReturnCode_t ret = greenstone::dds::ReturnCode_t::RETCODE_OK;
+    std::thread waiter([this, &maxWait, &done, &ret, &doneCondition]()
+    {
+        ret = m_reader->wait_for_historical_data(maxWait);
+        done = true;
+        doneCondition.set_trigger_value(true);
+    });
+
+    while (!done)
+    {
+        if (!take_all(handler))
+        {
+            waitset.wait(activeConditions, greenstone::dds::Duration_t().duration_infinite());
+            std::this_thread::sleep_for(BATCH_DELAY);
+        }
+    }
+    waiter.join();
+    waitset.detach_condition(&doneCondition);
+
+    // The wait may return before the last samples are inserted into the cache, take until it stays empty.
+    // Live samples may keep the cache from ever staying empty, so the settle phase is bounded as well
+    auto quiet = std::chrono::steady_clock::now();
+    auto deadline = quiet + m_settle * SETTLE_LIMIT;
+    while (true)
+    {
+        if (take_all(handler))
+        {
+            quiet = std::chrono::steady_clock::now();
+        }
+        auto now = std::chrono::steady_clock::now();
+        auto end = (std::min)(quiet + std::chrono::steady_clock::duration(m_settle), deadline);
+        if (now >= end)
+        {
+            break;
+        }
+        if (waitset.wait(activeConditions, to_duration(end - now)) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            std::this_thread::sleep_for(BATCH_DELAY);
+        }
+    }
+
+    waitset.detach_condition(readCondition);
+    m_reader->delete_readcondition(readCondition);
+    return ret;
+}
+
+bool HistoryCatchUp::take_all(const SampleHandler& handler)
+{
+    bool taken = false;
+    dds::core::SampleInfo info;
+    while (true)
+    {
+        DDS::OriginalData data;
+        if (m_reader->take_next_sample_original(data, info) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            break;
+        }
+        taken = true;
+        if (info.valid_data)
+        {
+            ++m_samples;
+            m_bytes += data.getDataLength();
+            handler(data, info);
+        }
+    }
+    return taken;
+}
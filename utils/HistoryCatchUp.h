@@ -0,0 +1,71 @@
+/**************************************************************
+* @file HistoryCatchUp.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef HISTORY_CATCH_UP_H
+#define HISTORY_CATCH_UP_H
+
+#include <chrono>
+#include <functional>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class HistoryCatchUp
+* @brief This class receives the historical data of a late-joining DataReader of a non-VOLATILE topic by taking
+*        the samples while they arrive, instead of waiting for all of them with wait_for_historical_data first.
+* @note Inserting a sample into the reader cache gets slower as the cache grows, so letting the history pile up
+*       until wait_for_historical_data returns costs much more than the delivery itself for deep histories.
+*       run() waits for the historical data in a separate thread and takes the samples in their serialized
+*       form in the calling thread meanwhile, handing each one to a handler. The wait may return just before
+*       the last samples are inserted into the cache, so run() returns the result of wait_for_historical_data
+*       only once the cache has stayed empty for the settle time, or after five settle times if live samples
+*       keep arriving, which are then left to the application. While the cache is empty, both phases sleep in
+*       a WaitSet on a ReadCondition of the reader for samples not read yet. The reader must already be matched
+*       with the writers whose history is expected, otherwise wait_for_historical_data returns at once. run()
+*       returns RETCODE_ERROR if the ReadCondition cannot be created.
+*/
+
+class HistoryCatchUp
+{
+public:
+    // Handler of a sample taken, in its serialized form
+    using SampleHandler = std::function<void(DDS::OriginalData&, const dds::core::SampleInfo&)>;
+
+    explicit HistoryCatchUp(
+        greenstone::dds::DataReader* reader,
+        const std::chrono::microseconds& settle = std::chrono::milliseconds(20))
+        : m_reader(reader),
+          m_settle(settle),
+          m_samples(0),
+          m_bytes(0)
+    {
+    }
+
+    // Take samples until the historical data has been received or maxWait has passed
+    greenstone::dds::ReturnCode_t run(const greenstone::dds::Duration_t& maxWait, const SampleHandler& handler);
+
+    // Get the number of samples with valid data taken
+    uint64_t get_number_of_samples() const
+    {
+        return m_samples;
+    }
+
+    // Get the number of bytes of the samples taken, including their encapsulation header
+    uint64_t get_number_of_bytes() const
+    {
+        return m_bytes;
+    }
+
+private:
+    // Take all samples in the reader cache, return false if it was empty
+    bool take_all(const SampleHandler& handler);
+
+    greenstone::dds::DataReader* m_reader;
+    std::chrono::microseconds m_settle;
+    uint64_t m_samples;
+    uint64_t m_bytes;
+};
+
+#endif // HISTORY_CATCH_UP_H
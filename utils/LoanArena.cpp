@@ -0,0 +1,91 @@
+/**************************************************************
+* @file LoanArena.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "LoanArena.h"
+
+#include <cstring>
+
+void OffsetRange::reset(const void* target, uint32_t count)
+{
+    if ((target == nullptr) || (count == 0))
+    {
+        m_offset = 0;
+        m_size = 0;
+        return;
+    }
+    // The elements are always placed after their container, within the same loan
+    m_offset = static_cast<uint32_t>(static_cast<const uint8_t*>(target) - reinterpret_cast<const uint8_t*>(this));
+    m_size = count;
+}
+
+bool OffsetRange::is_within(const void* base, uint32_t size, uint64_t bytes) const
+{
+    if (m_size == 0)
+    {
+        return true;
+    }
+    const uint8_t* begin = static_cast<const uint8_t*>(base);
+    const uint8_t* self = reinterpret_cast<const uint8_t*>(this);
+    if ((self < begin) || (self >= begin + size))
+    {
+        return false;
+    }
+    uint64_t offset = static_cast<uint64_t>(self - begin) + m_offset;
+    return (offset <= size) && (bytes <= size - offset);
+}
+
+bool OffsetString::is_within(const void* base, uint32_t size) const
+{
+    return empty() || (OffsetRange::is_within(base, size, static_cast<uint64_t>(this->size()) + 1) &&
+        (c_str()[this->size()] == '\0'));
+}
+
+LoanArena::LoanArena(void* buffer, uint32_t capacity, uint32_t fixedSize)
+    : m_buffer(static_cast<uint8_t*>(buffer)),
+      m_capacity((buffer == nullptr) ? 0 : capacity),
+      m_used((fixedSize < m_capacity) ? fixedSize : m_capacity)
+{
+}
+
+bool LoanArena::assign(OffsetString& text, const char* value, uint32_t length)
+{
+    if (length == 0)
+    {
+        text.reset(nullptr, 0);
+        return true;
+    }
+    char* characters = static_cast<char*>(reserve(static_cast<uint64_t>(length) + 1, 1));
+    if (characters == nullptr)
+    {
+        return false;
+    }
+    memcpy(characters, value, length);
+    characters[length] = '\0';
+    text.reset(characters, length);
+    return true;
+}
+
+uint64_t LoanArena::extend(uint64_t used, uint64_t bytes, uint32_t alignment)
+{
+    // Alignment is relative to the start of the loan, so that the layout is the same in every process
+    if (alignment > 1)
+    {
+        used = (used + alignment - 1) / alignment * alignment;
+    }
+    return used + bytes;
+}
+
+void* LoanArena::reserve(uint64_t bytes, uint32_t alignment)
+{
+    uint64_t end = extend(m_used, bytes, alignment);
+    if (end > m_capacity)
+    {
+        return nullptr;
+    }
+    void* reserved = m_buffer + (end - bytes);
+    m_used = static_cast<uint32_t>(end);
+    return reserved;
+}
@@ -0,0 +1,197 @@
+/**************************************************************
+* @file LoanArena.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef LOAN_ARENA_H
+#define LOAN_ARENA_H
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+* @class OffsetRange
+* @brief This class is the base of the containers of a loaned sample, which refer to their elements by their
+*        offset from the container itself instead of by a pointer.
+* @note A loaned sample is mapped at a different address in every process, so a pointer written by the writer
+*       is meaningless to the readers. An offset from the container stays valid wherever the segment is mapped,
+*       as long as the container is not moved, so containers cannot be copied.
+*/
+
+class OffsetRange
+{
+public:
+    OffsetRange()
+        : m_offset(0),
+          m_size(0)
+    {
+    }
+
+    OffsetRange(const OffsetRange&) = delete;
+    OffsetRange& operator=(const OffsetRange&) = delete;
+
+    // Get the number of elements
+    uint32_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    // Point the range at count elements stored at target, or at none if target is nullptr
+    void reset(const void* target, uint32_t count);
+
+protected:
+    // Get the address of the first element, nullptr if the range is empty
+    const uint8_t* address() const
+    {
+        return (m_size == 0) ? nullptr : reinterpret_cast<const uint8_t*>(this) + m_offset;
+    }
+
+    // Whether bytes from the first element lie within size bytes from base
+    bool is_within(const void* base, uint32_t size, uint64_t bytes) const;
+
+private:
+    uint32_t m_offset;
+    uint32_t m_size;
+};
+
+/**
+* @class OffsetString
+* @brief A string of a loaned sample, held NUL-terminated in the bytes of the sample.
+*/
+
+class OffsetString : public OffsetRange
+{
+public:
+    const char* c_str() const
+    {
+        return empty() ? "" : reinterpret_cast<const char*>(address());
+    }
+
+    std::string str() const
+    {
+        return std::string(c_str(), size());
+    }
+
+    // Whether the characters and the terminator lie within size bytes from base
+    bool is_within(const void* base, uint32_t size) const;
+};
+
+/**
+* @class OffsetVector
+* @brief A sequence of a loaned sample, held in the bytes of the sample. The elements must be trivially copyable.
+*/
+
+template<typename T>
+class OffsetVector : public OffsetRange
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Elements of a loaned sample must be trivially copyable");
+
+public:
+    const T* data() const
+    {
+        return reinterpret_cast<const T*>(address());
+    }
+
+    T* data()
+    {
+        return const_cast<T*>(reinterpret_cast<const T*>(address()));
+    }
+
+    const T& operator[](uint32_t index) const
+    {
+        return data()[index];
+    }
+
+    T& operator[](uint32_t index)
+    {
+        return data()[index];
+    }
+
+    const T* begin() const
+    {
+        return data();
+    }
+
+    const T* end() const
+    {
+        return data() + size();
+    }
+
+    // Whether the elements lie within size bytes from base and are aligned
+    bool is_within(const void* base, uint32_t size) const
+    {
+        return ((reinterpret_cast<uintptr_t>(data()) % alignof(T)) == 0) &&
+            OffsetRange::is_within(base, size, static_cast<uint64_t>(this->size()) * sizeof(T));
+    }
+};
+
+/**
+* @class LoanArena
+* @brief This class lays out the strings and sequences of a variable-length sample in a buffer loaned with
+*        DataWriter::loan_sample, so that a type holding OffsetString and OffsetVector members can be written
+*        through shared memory without serialization.
+* @note The fixed part of the sample takes the first bytes of the buffer and the elements are placed after it
+*       in the order they are assigned. Sequences are allocated rather than copied, so that the writer fills
+*       them in place. The bytes a sample needs are computed beforehand with extend(), since a loan cannot grow.
+*       Readers taking the sample as a LoanableTypeData read the same bytes, and should check the containers
+*       with is_within() against the size recorded in the sample before using them.
+*/
+
+class LoanArena
+{
+public:
+    // Lay out a sample in capacity bytes at buffer, whose fixed part takes the first fixedSize bytes
+    LoanArena(void* buffer, uint32_t capacity, uint32_t fixedSize);
+
+    // Copy length characters to the arena and point text at them, return false if the arena is full
+    bool assign(OffsetString& text, const char* value, uint32_t length);
+
+    bool assign(OffsetString& text, const std::string& value)
+    {
+        return assign(text, value.c_str(), static_cast<uint32_t>(value.size()));
+    }
+
+    // Allocate count elements for values to be filled in place, return nullptr if the arena is full
+    template<typename T>
+    T* allocate(OffsetVector<T>& values, uint32_t count)
+    {
+        void* elements = reserve(static_cast<uint64_t>(count) * sizeof(T), alignof(T));
+        if (elements == nullptr)
+        {
+            return nullptr;
+        }
+        values.reset(elements, count);
+        return static_cast<T*>(elements);
+    }
+
+    // Get the bytes used, to be recorded in the sample
+    uint32_t get_used() const
+    {
+        return m_used;
+    }
+
+    uint32_t get_capacity() const
+    {
+        return m_capacity;
+    }
+
+    // Get the bytes needed after used bytes to place bytes more with the given alignment
+    static uint64_t extend(uint64_t used, uint64_t bytes, uint32_t alignment = 1);
+
+private:
+    // Reserve bytes with the given alignment, return nullptr if they do not fit
+    void* reserve(uint64_t bytes, uint32_t alignment);
+
+    uint8_t* m_buffer;
+    uint32_t m_capacity;
+    uint32_t m_used;
+};
+
+#endif // LOAN_ARENA_H
@@ -0,0 +1,201 @@
+/**************************************************************
+* @file NumaBinding.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "NumaBinding.h"
+
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+    // Memory policies of set_mempolicy, as defined by numaif.h
+    const int MPOL_DEFAULT_POLICY = 0;
+    const int MPOL_PREFERRED_POLICY = 1;
+    const unsigned long MAX_NODES = 8 * sizeof(unsigned long);
+
+    // Parse a CPU list such as "0-3,8-11" into cpus
+    void parse_cpu_list(const std::string& list, cpu_set_t& cpus)
+    {
+        CPU_ZERO(&cpus);
+        std::stringstream ranges(list);
+        std::string range;
+        while (std::getline(ranges, range, ','))
+        {
+            if (range.empty() || (range[0] < '0') || (range[0] > '9'))
+            {
+                continue;
+            }
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; (cpu <= last) && (cpu < CPU_SETSIZE); ++cpu)
+            {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+    }
+}
+
+NumaBinding::NumaBinding(int32_t node)
+    : m_bound(false),
+      m_previousPolicy(MPOL_DEFAULT_POLICY),
+      m_previousNodes(0)
+{
+    if (node < 0)
+    {
+        return;
+    }
+
+    cpu_set_t nodeCpus;
+    if ((static_cast<unsigned long>(node) >= MAX_NODES) || !get_node_cpus(node, nodeCpus))
+    {
+        std::cout << "NUMA node " << node << " not found, the thread is not bound" << std::endl;
+        return;
+    }
+
+    if ((sched_getaffinity(0, sizeof(m_previousCpus), &m_previousCpus) != 0) ||
+        (syscall(SYS_get_mempolicy, &m_previousPolicy, &m_previousNodes, MAX_NODES, nullptr, 0) != 0))
+    {
+        std::cout << "Failed to get the binding of the thread" << std::endl;
+        return;
+    }
+
+    unsigned long nodeMask = 1UL << node;
+    if (sched_setaffinity(0, sizeof(nodeCpus), &nodeCpus) != 0)
+    {
+        std::cout << "Failed to bind the thread to the CPUs of NUMA node " << node << std::endl;
+        return;
+    }
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED_POLICY, &nodeMask, MAX_NODES) != 0)
+    {
+        std::cout << "Failed to prefer the memory of NUMA node " << node << std::endl;
+        sched_setaffinity(0, sizeof(m_previousCpus), &m_previousCpus);
+        return;
+    }
+    m_bound = true;
+}
+
+NumaBinding::~NumaBinding()
+{
+    if (!m_bound)
+    {
+        return;
+    }
+    sched_setaffinity(0, sizeof(m_previousCpus), &m_previousCpus);
+    syscall(SYS_set_mempolicy, m_previousPolicy,
+        (m_previousPolicy == MPOL_DEFAULT_POLICY) ? nullptr : &m_previousNodes, MAX_NODES);
+}
+
+int32_t NumaBinding::get_number_of_nodes()
+{
+    int32_t count = 0;
+    cpu_set_t cpus;
+    while ((static_cast<unsigned long>(count) < MAX_NODES) && get_node_cpus(count, cpus))
+    {
+        ++count;
+    }
+    return count;
+}
+
+bool NumaBinding::get_node_cpus(int32_t node, cpu_set_t& cpus)
+{
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!std::getline(file, list))
+    {
+        return false;
+    }
+    parse_cpu_list(list, cpus);
+    return true;
+}
+
+std::string NumaBinding::get_placement()
+{
+    int32_t nodes = get_number_of_nodes();
+    std::ostringstream placement;
+
+    // Threads by the node their affinity is confined to, or -1 if they may run on several nodes
+    std::map<int32_t, uint32_t> threads;
+    DIR* tasks = opendir("/proc/self/task");
+    if (tasks != nullptr)
+    {
+        while (struct dirent* entry = readdir(tasks))
+        {
+            if (entry->d_name[0] == '.')
+            {
+                continue;
+            }
+            cpu_set_t allowed;
+            if (sched_getaffinity(std::stoi(entry->d_name), sizeof(allowed), &allowed) != 0)
+            {
+                continue;
+            }
+            int32_t confined = -1;
+            for (int32_t node = 0; node < nodes; ++node)
+            {
+                cpu_set_t nodeCpus;
+                cpu_set_t combined;
+                get_node_cpus(node, nodeCpus);
+                CPU_OR(&combined, &allowed, &nodeCpus);
+                if (CPU_EQUAL(&combined, &nodeCpus))
+                {
+                    confined = node;
+                    break;
+                }
+            }
+            ++threads[confined];
+        }
+        closedir(tasks);
+    }
+    placement << "threads:";
+    for (auto& count : threads)
+    {
+        placement << ' ' << ((count.first < 0) ? std::string("any") : "N" + std::to_string(count.first))
+                  << '=' << count.second;
+    }
+
+    // Resident memory by node, from the pages counted per node and mapping in numa_maps
+    std::map<int32_t, uint64_t> residentKb;
+    std::ifstream maps("/proc/self/numa_maps");
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        std::stringstream fields(line);
+        std::string field;
+        uint64_t pageKb = 4;
+        std::map<int32_t, uint64_t> pages;
+        while (fields >> field)
+        {
+            size_t equal = field.find('=');
+            if (equal == std::string::npos)
+            {
+                continue;
+            }
+            if ((field[0] == 'N') && (field[1] >= '0') && (field[1] <= '9'))
+            {
+                pages[std::stoi(field.substr(1, equal - 1))] += std::stoull(field.substr(equal + 1));
+            }
+            else if (field.compare(0, equal, "kernelpagesize_kB") == 0)
+            {
+                pageKb = std::stoull(field.substr(equal + 1));
+            }
+        }
+        for (auto& count : pages)
+        {
+            residentKb[count.first] += count.second * pageKb;
+        }
+    }
+    placement << "; memory:";
+    for (auto& kb : residentKb)
+    {
+        placement << " N" << kb.first << '=' << kb.second / 1024 << " MB";
+    }
+    return placement.str();
+}
@@ -0,0 +1,53 @@
+/**************************************************************
+* @file NumaBinding.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef NUMA_BINDING_H
+#define NUMA_BINDING_H
+
+#include <sched.h>
+#include <cstdint>
+#include <string>
+
+/**
+* @class NumaBinding
+* @brief This class binds the calling thread to the CPUs of a NUMA node and makes it prefer the memory of that
+*        node for as long as it is in scope, then restores the previous binding.
+* @note Threads created while the binding is in scope inherit it, and memory is placed on the node of the
+*       thread touching it first. Creating a participant in scope therefore places its receive threads, and the
+*       pages of its shared memory segment they touch, on the node. Creating a DataWriter or DataReader in scope
+*       places the caches it allocates at creation. A negative node leaves the thread as it is.
+*/
+
+class NumaBinding
+{
+public:
+    explicit NumaBinding(int32_t node);
+
+    ~NumaBinding();
+
+    // Check whether the calling thread was bound to the node
+    bool is_bound() const
+    {
+        return m_bound;
+    }
+
+    // Get the number of NUMA nodes of the host
+    static int32_t get_number_of_nodes();
+
+    // Get the CPUs of a NUMA node, return false if the node does not exist
+    static bool get_node_cpus(int32_t node, cpu_set_t& cpus);
+
+    // Describe on which nodes the threads of the process run and its resident memory lies
+    static std::string get_placement();
+
+private:
+    bool m_bound;
+    cpu_set_t m_previousCpus;
+    int m_previousPolicy;
+    unsigned long m_previousNodes;
+};
+
+#endif // NUMA_BINDING_H
@@ -0,0 +1,501 @@
+/**************************************************************
+* @file PersistentHistory.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "PersistentHistory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    // Header at the start of every segment file
+    struct SegmentHeader
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t number;
+        uint8_t reserved[48];
+    };
+
+    // Header of every record. The magic is stored last, but the pages of a record may still reach the disk
+    // in any order, so a record is only accepted if the checksum of its header and payload matches
+    struct RecordHeader
+    {
+        uint32_t magic;
+        uint32_t length;
+        uint64_t sequence;
+        int32_t seconds;
+        uint32_t nanosec;
+        uint8_t handle[16];
+        uint32_t checksum;
+        uint32_t reserved;
+    };
+
+    const uint64_t SEGMENT_MAGIC = 0x474F4C5344445347ULL;
+    const uint32_t SEGMENT_VERSION = 2;
+    const uint32_t RECORD_MAGIC = 0x44524352U;
+    const uint64_t RECORD_ALIGNMENT = 8;
+    const uint32_t ENCAPSULATION_SIZE = 4;
+
+    uint64_t record_size(uint64_t length)
+    {
+        return (sizeof(RecordHeader) + length + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    }
+
+    std::array<uint8_t, 16> handle_key(const uint8_t* handle)
+    {
+        std::array<uint8_t, 16> key;
+        memcpy(key.data(), handle, key.size());
+        return key;
+    }
+
+    // CRC-32 (IEEE 802.3) of bytes, continuing from crc
+    uint32_t crc32(uint32_t crc, const uint8_t* bytes, uint64_t length)
+    {
+        static const std::array<uint32_t, 256> table = []()
+        {
+            std::array<uint32_t, 256> entries;
+            for (uint32_t i = 0; i < entries.size(); ++i)
+            {
+                uint32_t value = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    value = (value & 1U) ? (0xEDB88320U ^ (value >> 1)) : (value >> 1);
+                }
+                entries[i] = value;
+            }
+            return entries;
+        }();
+        crc = ~crc;
+        for (uint64_t i = 0; i < length; ++i)
+        {
+            crc = table[(crc ^ bytes[i]) & 0xFFU] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    // Checksum of a record, covering its header from the length on and its payload
+    uint32_t record_checksum(const RecordHeader* header)
+    {
+        const uint8_t* begin = reinterpret_cast<const uint8_t*>(header);
+        uint32_t crc = crc32(0, begin + offsetof(RecordHeader, length),
+            offsetof(RecordHeader, checksum) - offsetof(RecordHeader, length));
+        return crc32(crc, begin + sizeof(RecordHeader), header->length);
+    }
+}
+
+PersistentHistory::PersistentHistory()
+    : m_depth(1),
+      m_segmentSize(0),
+      m_commitBytes(0),
+      m_pending(0),
+      m_sequence(0),
+      m_records(0),
+      m_bytes(0)
+{
+}
+
+PersistentHistory::~PersistentHistory()
+{
+    close();
+}
+
+bool PersistentHistory::open(
+    const std::string& directory,
+    const std::string& name,
+    uint32_t depth,
+    uint64_t segmentSize,
+    uint64_t commitBytes)
+{
+    close();
+    if (segmentSize <= sizeof(SegmentHeader) + sizeof(RecordHeader))
+    {
+        std::cout << "Segment size " << segmentSize << " is too small for the history log" << std::endl;
+        return false;
+    }
+    m_directory = directory;
+    m_name = name;
+    m_depth = depth;
+    m_segmentSize = segmentSize;
+    m_commitBytes = commitBytes;
+
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr)
+    {
+        std::cout << "Open directory " << directory << " of the history log error" << std::endl;
+        return false;
+    }
+
+    // Segment files are <name>.<number>.log, recovered in the order they were created
+    std::vector<uint32_t> numbers;
+    const std::string prefix = name + ".";
+    const std::string suffix = ".log";
+    while (struct dirent* entry = readdir(dir))
+    {
+        std::string file(entry->d_name);
+        if ((file.size() > prefix.size() + suffix.size()) &&
+            (file.compare(0, prefix.size(), prefix) == 0) &&
+            (file.compare(file.size() - suffix.size(), suffix.size(), suffix) == 0))
+        {
+            std::string digits = file.substr(prefix.size(), file.size() - prefix.size() - suffix.size());
+            if (!digits.empty() && std::all_of(digits.begin(), digits.end(), ::isdigit))
+            {
+                numbers.push_back(static_cast<uint32_t>(std::stoul(digits)));
+            }
+        }
+    }
+    closedir(dir);
+    std::sort(numbers.begin(), numbers.end());
+
+    for (uint32_t number : numbers)
+    {
+        if (map_segment(number, false))
+        {
+            recover_segment();
+        }
+    }
+
+    // Records are no longer referenced by anyone while opening
+    for (size_t i = 0; i + 1 < m_segments.size();)
+    {
+        if (m_segments[i].records == 0)
+        {
+            retire_segment(m_segments[i].number);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    release_retired();
+
+    if (m_segments.empty())
+    {
+        return map_segment(numbers.empty() ? 0 : numbers.back() + 1, true);
+    }
+    return true;
+}
+
+void PersistentHistory::close()
+{
+    commit();
+    release_retired();
+    for (Segment& segment : m_segments)
+    {
+        munmap(segment.base, segment.size);
+        ::close(segment.fd);
+    }
+    m_segments.clear();
+    m_index.clear();
+    m_pending = 0;
+    m_sequence = 0;
+    m_records = 0;
+    m_bytes = 0;
+}
+
+bool PersistentHistory::append(
+    const greenstone::dds::InstanceHandle_t& handle,
+    const uint8_t* data,
+    uint32_t length,
+    const DDS::Time_t& timestamp,
+    Record& record)
+{
+    if (m_segments.empty())
+    {
+        return false;
+    }
+    uint64_t size = record_size(ENCAPSULATION_SIZE + static_cast<uint64_t>(length));
+    if (size > m_segmentSize - sizeof(SegmentHeader))
+    {
+        std::cout << "Sample of " << length << " bytes does not fit in a segment of the history log" << std::endl;
+        return false;
+    }
+
+    if (m_segments.back().used + size > m_segments.back().size)
+    {
+        Segment& full = m_segments.back();
+        flush_segment(full);
+        uint32_t next = full.number + 1;
+        if (full.records == 0)
+        {
+            retire_segment(full.number);
+        }
+        if (!map_segment(next, true))
+        {
+            return false;
+        }
+    }
+
+    Segment& segment = m_segments.back();
+    uint64_t offset = segment.used;
+    uint8_t* position = segment.base + offset;
+    RecordHeader* header = reinterpret_cast<RecordHeader*>(position);
+    header->length = ENCAPSULATION_SIZE + length;
+    header->sequence = m_sequence++;
+    header->seconds = timestamp.seconds();
+    header->nanosec = timestamp.nanosec();
+    memcpy(header->handle, handle.value, sizeof(header->handle));
+
+    // Plain CDR in the byte order of the host, as expected by write_f_buffer and write_original
+    const uint16_t probe = 1;
+    uint8_t* payload = position + sizeof(RecordHeader);
+    payload[0] = 0x00;
+    payload[1] = (*reinterpret_cast<const uint8_t*>(&probe) == 1) ? 0x01 : 0x00;
+    payload[2] = 0x00;
+    payload[3] = 0x00;
+    memcpy(payload + ENCAPSULATION_SIZE, data, length);
+    header->checksum = record_checksum(header);
+    header->reserved = 0;
+
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = RECORD_MAGIC;
+
+    // Indexing may retire other segments, which invalidates the reference to this one
+    uint32_t number = segment.number;
+    segment.used += size;
+    index_record(number, offset);
+    record = get_record(Location {number, offset});
+
+    m_pending += size;
+    if (m_pending >= m_commitBytes)
+    {
+        return commit();
+    }
+    return true;
+}
+
+bool PersistentHistory::commit()
+{
+    bool ret = true;
+    for (Segment& segment : m_segments)
+    {
+        ret = flush_segment(segment) && ret;
+    }
+    m_pending = 0;
+    return ret;
+}
+
+void PersistentHistory::for_each(const std::function<void(const Record&)>& visitor) const
+{
+    std::vector<Record> records;
+    records.reserve(m_records);
+    for (const auto& instance : m_index)
+    {
+        for (const Location& location : instance.second)
+        {
+            records.push_back(get_record(location));
+        }
+    }
+    std::sort(records.begin(), records.end(), [](const Record& lhs, const Record& rhs)
+    {
+        return lhs.sequence < rhs.sequence;
+    });
+    for (const Record& record : records)
+    {
+        visitor(record);
+    }
+}
+
+bool PersistentHistory::map_segment(uint32_t number, bool create)
+{
+    char file[32];
+    snprintf(file, sizeof(file), ".%06u.log", number);
+    std::string path = m_directory + "/" + m_name + file;
+
+    // A new segment must not replace a file left with the same number
+    int fd = ::open(path.c_str(), create ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, 0644);
+    if (fd < 0)
+    {
+        std::cout << "Open segment " << path << " of the history log error"
+                  << ((create && (errno == EEXIST)) ? ", the file already exists" : "") << std::endl;
+        return false;
+    }
+
+    uint64_t size = m_segmentSize;
+    if (create)
+    {
+        // Allocate the blocks now, a full disk would otherwise stop the process while writing the mapping
+        if (posix_fallocate(fd, 0, static_cast<off_t>(size)) != 0)
+        {
+            std::cout << "Allocate segment " << path << " of the history log error" << std::endl;
+            ::close(fd);
+            unlink(path.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        struct stat st;
+        if ((fstat(fd, &st) != 0) || (static_cast<uint64_t>(st.st_size) < sizeof(SegmentHeader)))
+        {
+            ::close(fd);
+            return false;
+        }
+        size = static_cast<uint64_t>(st.st_size);
+    }
+
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED)
+    {
+        std::cout << "Map segment " << path << " of the history log error" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    SegmentHeader* header = static_cast<SegmentHeader*>(base);
+    if (create)
+    {
+        header->magic = SEGMENT_MAGIC;
+        header->version = SEGMENT_VERSION;
+        header->number = number;
+    }
+    else if ((header->magic != SEGMENT_MAGIC) || (header->version != SEGMENT_VERSION))
+    {
+        std::cout << "Segment " << path << " is not a history log, skipped" << std::endl;
+        munmap(base, size);
+        ::close(fd);
+        return false;
+    }
+
+    m_segments.push_back(Segment {path, number, fd, static_cast<uint8_t*>(base), size, sizeof(SegmentHeader), 0, 0});
+    return true;
+}
+
+void PersistentHistory::recover_segment()
+{
+    // Indexing may retire other segments, which invalidates references into m_segments
+    uint32_t number = m_segments.back().number;
+    uint8_t* base = m_segments.back().base;
+    uint64_t size = m_segments.back().size;
+    uint64_t offset = sizeof(SegmentHeader);
+    while (offset + sizeof(RecordHeader) <= size)
+    {
+        RecordHeader* header = reinterpret_cast<RecordHeader*>(base + offset);
+        if ((header->magic != RECORD_MAGIC) || (header->length < ENCAPSULATION_SIZE) ||
+            (offset + record_size(header->length) > size) || (header->checksum != record_checksum(header)))
+        {
+            break;
+        }
+        m_sequence = std::max(m_sequence, header->sequence + 1);
+        index_record(number, offset);
+        offset += record_size(header->length);
+    }
+
+    // Clear a record left incomplete or torn, the next record appended there must not be mistaken for it
+    if (offset + sizeof(RecordHeader) <= size)
+    {
+        RecordHeader* header = reinterpret_cast<RecordHeader*>(base + offset);
+        uint64_t torn = std::min<uint64_t>(record_size(header->length), size - offset);
+        memset(base + offset, 0, static_cast<size_t>(torn));
+    }
+    Segment& segment = m_segments[find_segment(number)];
+    segment.used = offset;
+    segment.flushed = segment.used;
+}
+
+void PersistentHistory::index_record(uint32_t segment, uint64_t offset)
+{
+    int32_t position = find_segment(segment);
+    Segment& current = m_segments[position];
+    const RecordHeader* header = reinterpret_cast<const RecordHeader*>(current.base + offset);
+    std::deque<Location>& locations = m_index[handle_key(header->handle)];
+    locations.push_back(Location {segment, offset});
+    ++current.records;
+    ++m_records;
+    m_bytes += header->length;
+
+    if ((m_depth == 0) || (locations.size() <= m_depth))
+    {
+        return;
+    }
+
+    Location oldest = locations.front();
+    locations.pop_front();
+    int32_t oldestPosition = find_segment(oldest.segment);
+    Segment& holder = m_segments[oldestPosition];
+    m_bytes -= reinterpret_cast<const RecordHeader*>(holder.base + oldest.offset)->length;
+    --m_records;
+    if ((--holder.records == 0) && (static_cast<size_t>(oldestPosition) + 1 < m_segments.size()))
+    {
+        retire_segment(oldest.segment);
+    }
+}
+
+bool PersistentHistory::flush_segment(Segment& segment)
+{
+    if (segment.used <= segment.flushed)
+    {
+        return true;
+    }
+    static const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t start = segment.flushed & ~(pageSize - 1);
+    if (msync(segment.base + start, segment.used - start, MS_SYNC) != 0)
+    {
+        std::cout << "Flush segment " << segment.path << " of the history log error" << std::endl;
+        return false;
+    }
+    segment.flushed = segment.used;
+    return true;
+}
+
+void PersistentHistory::retire_segment(uint32_t segment)
+{
+    int32_t position = find_segment(segment);
+    if (position < 0)
+    {
+        return;
+    }
+    unlink(m_segments[position].path.c_str());
+    m_retired.push_back(m_segments[position]);
+    m_segments.erase(m_segments.begin() + position);
+}
+
+void PersistentHistory::release_retired()
+{
+    for (Segment& segment : m_retired)
+    {
+        munmap(segment.base, segment.size);
+        ::close(segment.fd);
+    }
+    m_retired.clear();
+}
+
+int32_t PersistentHistory::find_segment(uint32_t number) const
+{
+    // Segments are few and sorted, the current one is searched first
+    for (int32_t i = static_cast<int32_t>(m_segments.size()) - 1; i >= 0; --i)
+    {
+        if (m_segments[i].number == number)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+PersistentHistory::Record PersistentHistory::get_record(const Location& location) const
+{
+    const Segment& segment = m_segments[find_segment(location.segment)];
+    uint8_t* position = segment.base + location.offset;
+    const RecordHeader* header = reinterpret_cast<const RecordHeader*>(position);
+    Record record;
+    memcpy(record.handle.value, header->handle, sizeof(header->handle));
+    record.timestamp = DDS::Time_t(header->seconds, header->nanosec);
+    record.sequence = header->sequence;
+    record.payload = position + sizeof(RecordHeader);
+    record.length = header->length;
+    return record;
+}
@@ -0,0 +1,164 @@
+/**************************************************************
+* @file PersistentHistory.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef PERSISTENT_HISTORY_H
+#define PERSISTENT_HISTORY_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class PersistentHistory
+* @brief This class keeps the serialized samples of a DataWriter in an append-only log on disk, so that a
+*        writer restarted after its process ended can publish its history again to late-joining readers.
+* @note The log is split into segment files of a fixed size named <name>.<number>.log, each mapped into
+*       memory. A record holds the instance handle, the source timestamp and a sequence number, followed by
+*       the payload with its encapsulation header, ready for write_f_buffer or write_original. The payload of
+*       a record stays at the same address while the history is open, and the DataWriter sends it from the
+*       mapped pages without a copy, which is why the depth of the log must not be smaller than the depth of
+*       the history of the writer. The index keeps the last depth records of every instance, 0 keeping all.
+*       The file of a segment left without retained records is deleted, but the segment stays mapped until
+*       release_retired() is called once the DataWriter acknowledged the samples superseding its records, or
+*       until close() after the DataWriter is deleted. Appended records are flushed to disk together
+*       once commitBytes have been appended since the last flush, or by commit(). Every record carries a
+*       CRC-32 of its header and payload. On the next open(), a record interrupted during append() or torn by
+*       a crash of the system before it was committed fails its checksum, and is dropped with the records
+*       appended after it in the same segment. Records not yet committed may thus be lost when the whole
+*       system stops. The history is not thread-safe.
+*/
+
+class PersistentHistory
+{
+public:
+    // A record of the log, the payload points into the mapped segment
+    struct Record
+    {
+        greenstone::dds::InstanceHandle_t handle;
+        DDS::Time_t timestamp;
+        uint64_t sequence;
+        uint8_t* payload;
+        uint32_t length;
+    };
+
+    PersistentHistory();
+
+    ~PersistentHistory();
+
+    // Open the log of a topic in an existing directory and rebuild the index from the records found
+    bool open(
+        const std::string& directory,
+        const std::string& name,
+        uint32_t depth = 1,
+        uint64_t segmentSize = 256ULL << 20,
+        uint64_t commitBytes = 4ULL << 20);
+
+    // Flush and unmap all segments
+    void close();
+
+    // Append a sample serialized by a TopicDataType, the encapsulation header is added in the log
+    bool append(
+        const greenstone::dds::InstanceHandle_t& handle,
+        const uint8_t* data,
+        uint32_t length,
+        const DDS::Time_t& timestamp,
+        Record& record);
+
+    // Flush the records appended since the last flush to disk
+    bool commit();
+
+    // Unmap the segments whose files were deleted, once the DataWriter no longer refers to their payloads
+    void release_retired();
+
+    // Get the number of segments whose files were deleted but are still mapped
+    uint64_t get_number_of_retired() const
+    {
+        return m_retired.size();
+    }
+
+    // Visit the retained records of all instances in the order they were appended
+    void for_each(const std::function<void(const Record&)>& visitor) const;
+
+    // Get the number of retained records
+    uint64_t get_number_of_records() const
+    {
+        return m_records;
+    }
+
+    // Get the number of instances with retained records
+    uint64_t get_number_of_instances() const
+    {
+        return m_index.size();
+    }
+
+    // Get the number of bytes of payload retained
+    uint64_t get_number_of_bytes() const
+    {
+        return m_bytes;
+    }
+
+private:
+    // Location of a record in the log
+    struct Location
+    {
+        uint32_t segment;
+        uint64_t offset;
+    };
+
+    // A mapped segment file
+    struct Segment
+    {
+        std::string path;
+        uint32_t number;
+        int fd;
+        uint8_t* base;
+        uint64_t size;
+        uint64_t used;
+        uint64_t flushed;
+        uint64_t records;
+    };
+
+    // Map a segment file, creating it with the segment size if it does not exist
+    bool map_segment(uint32_t number, bool create);
+
+    // Scan the records of the last mapped segment and add them to the index
+    void recover_segment();
+
+    // Add a record to the index and release the records it no longer retains
+    void index_record(uint32_t segment, uint64_t offset);
+
+    // Flush the appended part of a segment
+    bool flush_segment(Segment& segment);
+
+    // Delete the file of a segment without records, the mapping is released later
+    void retire_segment(uint32_t segment);
+
+    // Get the position of a mapped segment by number, -1 if it is not mapped
+    int32_t find_segment(uint32_t number) const;
+
+    // Get the record at a location
+    Record get_record(const Location& location) const;
+
+    std::string m_directory;
+    std::string m_name;
+    uint32_t m_depth;
+    uint64_t m_segmentSize;
+    uint64_t m_commitBytes;
+    uint64_t m_pending;
+    uint64_t m_sequence;
+    uint64_t m_records;
+    uint64_t m_bytes;
+    std::deque<Segment> m_segments;
+    std::vector<Segment> m_retired;
+    std::map<std::array<uint8_t, 16>, std::deque<Location>> m_index;
+};
+
+#endif // PERSISTENT_HISTORY_H
@@ -0,0 +1,127 @@
+/**************************************************************
+* @file ReaderLagGuard.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "ReaderLagGuard.h"
+
+#include <algorithm>
+#include <iostream>
+
+ReaderLagGuard::ReaderLagGuard(greenstone::dds::DataReader* reader, uint32_t maxLag, LagPolicy policy,
+    const LagHandler& handler)
+    : m_reader(reader),
+      m_maxLag(std::max<uint32_t>(maxLag, 1)),
+      m_policy(policy),
+      m_handler(handler),
+      m_readCondition(reader->create_readcondition(
+          DDS::NOT_READ_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE)),
+      m_samples(0),
+      m_dropped(0),
+      m_lagging(false),
+      m_stop(false)
+{
+}
+
+ReaderLagGuard::~ReaderLagGuard()
+{
+    m_stop = true;
+    m_wakeCondition.set_trigger_value(true);
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+    if (m_readCondition != nullptr)
+    {
+        m_reader->delete_readcondition(m_readCondition);
+    }
+}
+
+bool ReaderLagGuard::start()
+{
+    if (m_readCondition == nullptr)
+    {
+        std::cout << "Create read condition of the lag guard error" << std::endl;
+        return false;
+    }
+    if (!m_thread.joinable())
+    {
+        m_thread = std::thread(&ReaderLagGuard::run, this);
+    }
+    return true;
+}
+
+bool ReaderLagGuard::take(DDS::OriginalData& data, dds::core::SampleInfo& info, const std::chrono::microseconds& timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_cv.wait_for(lock, timeout, [this]() {return !m_backlog.empty();}))
+    {
+        return false;
+    }
+    data = std::move(m_backlog.front().data);
+    info = m_backlog.front().info;
+    m_backlog.pop_front();
+    if (m_lagging && (m_backlog.size() <= m_maxLag / 2))
+    {
+        m_wakeCondition.set_trigger_value(true);
+    }
+    return true;
+}
+
+uint32_t ReaderLagGuard::get_backlog()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<uint32_t>(m_backlog.size());
+}
+
+void ReaderLagGuard::run()
+{
+    // Wake up when samples arrive, the backlog is down to half or the guard is destroyed
+    greenstone::dds::WaitSet waitset;
+    waitset.attach_condition(m_readCondition);
+    waitset.attach_condition(&m_wakeCondition);
+    greenstone::dds::ConditionSeq activeConditions;
+
+    uint64_t reported = 0;
+    while (!m_stop)
+    {
+        Entry entry;
+        while (m_reader->take_next_sample_original(entry.data, entry.info) == greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            ++m_samples;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_backlog.size() >= m_maxLag)
+                {
+                    ++m_dropped;
+                    if (m_policy == LagPolicy::DROP_NEWEST)
+                    {
+                        continue;
+                    }
+                    m_backlog.pop_front();
+                }
+                m_backlog.push_back(std::move(entry));
+            }
+            m_cv.notify_one();
+            entry = Entry();
+        }
+
+        // Report when samples start being dropped, and when the backlog is down to half again
+        uint32_t backlog = get_backlog();
+        uint64_t dropped = m_dropped;
+        bool lagging = m_lagging;
+        if ((!lagging && (dropped > reported)) || (lagging && (backlog <= m_maxLag / 2)))
+        {
+            m_lagging = !lagging;
+            if (m_handler)
+            {
+                m_handler(LagStatus {dropped, dropped - reported, backlog, !lagging});
+            }
+            reported = dropped;
+        }
+
+        waitset.wait(activeConditions, greenstone::dds::Duration_t().duration_infinite());
+        m_wakeCondition.set_trigger_value(false);
+    }
+}
@@ -0,0 +1,118 @@
+/**************************************************************
+* @file ReaderLagGuard.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef READER_LAG_GUARD_H
+#define READER_LAG_GUARD_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class ReaderLagGuard
+* @brief This class bounds how far the application may lag behind a reliable DataReader, so that a slow
+*        application does not stall the reliable writers it is matched with.
+* @note A KEEP_ALL reader stops acknowledging once its cache holds resource_limits.max_samples samples the
+*       application has not taken. Its writers then keep the samples unacknowledged until their own history
+*       is full, and block every write for max_blocking_time, for all their readers. The guard takes the samples
+*       in their serialized form in a thread of its own as soon as they arrive, so the reader cache never fills
+*       up and the reader keeps acknowledging, and holds them in a backlog of at most maxLag samples the
+*       application takes from. Once the backlog is full, the policy drops either the samples arriving, so the
+*       application sees the gaps a best-effort reader would, or the oldest samples of the backlog, so it
+*       catches up from the latest. The lag handler is called from the thread of the guard when samples start
+*       being dropped, and when the backlog is down to half of maxLag again. The thread of the guard sleeps in a
+*       WaitSet on a ReadCondition of the reader for samples not read yet, and is woken up by take() once a
+*       lagging backlog is down to half. The thread is started by start(), which fails if the ReadCondition
+*       could not be created. The reader must not have a listener taking samples.
+*/
+
+class ReaderLagGuard
+{
+public:
+    // Samples dropped once the backlog is full
+    enum class LagPolicy
+    {
+        // Drop the samples arriving, as a best-effort reader would
+        DROP_NEWEST,
+        // Drop the oldest samples of the backlog, to catch up from the latest
+        DROP_OLDEST
+    };
+
+    // Status passed to the lag handler
+    struct LagStatus
+    {
+        // Number of samples dropped since the guard was created
+        uint64_t totalDropped;
+        // Number of samples dropped since the handler was last called
+        uint64_t droppedChange;
+        // Number of samples in the backlog
+        uint32_t backlog;
+        // Whether samples are being dropped
+        bool lagging;
+    };
+
+    using LagHandler = std::function<void(const LagStatus&)>;
+
+    ReaderLagGuard(greenstone::dds::DataReader* reader, uint32_t maxLag, LagPolicy policy,
+        const LagHandler& handler = nullptr);
+
+    ~ReaderLagGuard();
+
+    // Start taking the samples arriving, return false if the guard cannot wait for them
+    bool start();
+
+    // Take the oldest sample of the backlog, waiting up to timeout for one, return false if there is none
+    bool take(DDS::OriginalData& data, dds::core::SampleInfo& info,
+        const std::chrono::microseconds& timeout = std::chrono::microseconds(0));
+
+    // Get the number of samples in the backlog
+    uint32_t get_backlog();
+
+    // Get the number of samples taken from the reader, and of those dropped
+    uint64_t get_number_of_samples() const
+    {
+        return m_samples;
+    }
+
+    uint64_t get_number_of_dropped() const
+    {
+        return m_dropped;
+    }
+
+private:
+    // Sample held in the backlog
+    struct Entry
+    {
+        DDS::OriginalData data;
+        dds::core::SampleInfo info;
+    };
+
+    // Take the samples arriving into the backlog until the guard is destroyed
+    void run();
+
+    greenstone::dds::DataReader* m_reader;
+    uint32_t m_maxLag;
+    LagPolicy m_policy;
+    LagHandler m_handler;
+    greenstone::dds::ReadCondition* m_readCondition;
+    // Triggered to wake up the thread when the guard is destroyed or the backlog is down to half
+    greenstone::dds::GuardCondition m_wakeCondition;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Entry> m_backlog;
+    std::atomic<uint64_t> m_samples;
+    std::atomic<uint64_t> m_dropped;
+    std::atomic<bool> m_lagging;
+    std::atomic<bool> m_stop;
+    std::thread m_thread;
+};
+
+#endif // READER_LAG_GUARD_H
@@ -0,0 +1,250 @@
+/**************************************************************
+* @file SlabAllocator.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "SlabAllocator.h"
+
+#include <cstdlib>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+    const size_t MIN_BLOCK_SIZE = 16;
+    const size_t REGION_SIZE = 2 * 1024 * 1024;
+    // Memory policy of mbind preferring a node, as defined by numaif.h
+    const int MPOL_PREFERRED_POLICY = 1;
+
+    size_t get_block_size(uint32_t sizeClass)
+    {
+        return MIN_BLOCK_SIZE << sizeClass;
+    }
+
+    // Get the smallest size class holding size bytes, CLASS_COUNT if it is too large
+    uint32_t get_size_class(size_t size)
+    {
+        uint32_t sizeClass = 0;
+        while ((sizeClass < SlabAllocator::CLASS_COUNT) && (get_block_size(sizeClass) < size))
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    // Freelists of the calling thread, given back to the allocator when the thread exits
+    struct ThreadCache
+    {
+        SlabAllocator* owner {nullptr};
+        SlabAllocator::FreeList lists[SlabAllocator::CLASS_COUNT] {};
+
+        ~ThreadCache();
+    };
+
+    thread_local ThreadCache t_cache;
+    // Set once t_cache is destroyed, the blocks freed by the thread after go to the shared freelists
+    thread_local bool t_cacheDestroyed = false;
+
+    ThreadCache::~ThreadCache()
+    {
+        t_cacheDestroyed = true;
+        if (owner == nullptr)
+        {
+            return;
+        }
+        for (uint32_t sizeClass = 0; sizeClass < SlabAllocator::CLASS_COUNT; ++sizeClass)
+        {
+            while (lists[sizeClass].count > 0)
+            {
+                owner->release(sizeClass, lists[sizeClass]);
+            }
+        }
+    }
+
+    // Get the freelists of the calling thread for allocator, nullptr if the thread is exiting
+    SlabAllocator::FreeList* get_thread_lists(SlabAllocator* allocator)
+    {
+        if (t_cacheDestroyed)
+        {
+            return nullptr;
+        }
+        if (t_cache.owner != allocator)
+        {
+            if (t_cache.owner != nullptr)
+            {
+                return nullptr;
+            }
+            t_cache.owner = allocator;
+        }
+        return t_cache.lists;
+    }
+}
+
+SlabAllocator::SlabAllocator()
+    : m_shared(),
+      m_region(nullptr),
+      m_regionLeft(0),
+      m_reservedBytes(0)
+{
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    // Blocks may still be released after the allocator goes out of scope at exit, the regions are kept
+}
+
+void* SlabAllocator::allocate(size_t size, int32_t numaNode)
+{
+    uint32_t sizeClass = get_size_class(size);
+    if (sizeClass == CLASS_COUNT)
+    {
+        return std::malloc(size);
+    }
+
+    FreeList* lists = get_thread_lists(this);
+    if (lists == nullptr)
+    {
+        // The thread is exiting, take a single block from the shared freelist
+        FreeList single {nullptr, 0};
+        refill(sizeClass, single, numaNode);
+        FreeBlock* block = single.head;
+        if ((block != nullptr) && (single.count > 1))
+        {
+            single.head = block->next;
+            --single.count;
+            while (single.count > 0)
+            {
+                release(sizeClass, single);
+            }
+        }
+        return block;
+    }
+
+    FreeList& list = lists[sizeClass];
+    if (list.head == nullptr)
+    {
+        refill(sizeClass, list, numaNode);
+        if (list.head == nullptr)
+        {
+            return nullptr;
+        }
+    }
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    --list.count;
+    return block;
+}
+
+void SlabAllocator::deallocate(void* ptr, size_t size)
+{
+    uint32_t sizeClass = get_size_class(size);
+    if (sizeClass == CLASS_COUNT)
+    {
+        std::free(ptr);
+        return;
+    }
+
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    FreeList* lists = get_thread_lists(this);
+    if (lists == nullptr)
+    {
+        FreeList single {block, 1};
+        block->next = nullptr;
+        release(sizeClass, single);
+        return;
+    }
+
+    FreeList& list = lists[sizeClass];
+    block->next = list.head;
+    list.head = block;
+    ++list.count;
+    if (list.count > 2 * BATCH_SIZE)
+    {
+        release(sizeClass, list);
+    }
+}
+
+void SlabAllocator::refill(uint32_t sizeClass, FreeList& list, int32_t numaNode)
+{
+    std::lock_guard<std::mutex> lock(m_sharedMutex[sizeClass]);
+    FreeList& shared = m_shared[sizeClass];
+    if (shared.head == nullptr)
+    {
+        carve_slab(sizeClass, numaNode);
+    }
+    for (uint32_t i = 0; (i < BATCH_SIZE) && (shared.head != nullptr); ++i)
+    {
+        FreeBlock* block = shared.head;
+        shared.head = block->next;
+        --shared.count;
+        block->next = list.head;
+        list.head = block;
+        ++list.count;
+    }
+}
+
+void SlabAllocator::release(uint32_t sizeClass, FreeList& list)
+{
+    std::lock_guard<std::mutex> lock(m_sharedMutex[sizeClass]);
+    FreeList& shared = m_shared[sizeClass];
+    for (uint32_t i = 0; (i < BATCH_SIZE) && (list.head != nullptr); ++i)
+    {
+        FreeBlock* block = list.head;
+        list.head = block->next;
+        --list.count;
+        block->next = shared.head;
+        shared.head = block;
+        ++shared.count;
+    }
+}
+
+void SlabAllocator::carve_slab(uint32_t sizeClass, int32_t numaNode)
+{
+    size_t blockSize = get_block_size(sizeClass);
+    size_t slabSize = blockSize * BATCH_SIZE;
+    std::lock_guard<std::mutex> lock(m_regionMutex);
+    if (m_regionLeft < slabSize)
+    {
+        // Map twice the region size to align it on a huge page, and unmap what is around
+        size_t mappedSize = 2 * REGION_SIZE;
+        void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED)
+        {
+            return;
+        }
+        uintptr_t start = reinterpret_cast<uintptr_t>(mapped);
+        uintptr_t aligned = (start + REGION_SIZE - 1) & ~(static_cast<uintptr_t>(REGION_SIZE) - 1);
+        if (aligned > start)
+        {
+            munmap(mapped, aligned - start);
+        }
+        if (aligned + REGION_SIZE < start + mappedSize)
+        {
+            munmap(reinterpret_cast<void*>(aligned + REGION_SIZE), start + mappedSize - aligned - REGION_SIZE);
+        }
+
+        m_region = reinterpret_cast<char*>(aligned);
+        m_regionLeft = REGION_SIZE;
+        madvise(m_region, REGION_SIZE, MADV_HUGEPAGE);
+        if ((numaNode >= 0) && (numaNode < static_cast<int32_t>(8 * sizeof(unsigned long))))
+        {
+            unsigned long nodeMask = 1UL << numaNode;
+            syscall(SYS_mbind, m_region, REGION_SIZE, MPOL_PREFERRED_POLICY, &nodeMask, 8 * sizeof(unsigned long), 0);
+        }
+        m_reservedBytes.fetch_add(REGION_SIZE, std::memory_order_relaxed);
+    }
+
+    char* slab = m_region;
+    m_region += slabSize;
+    m_regionLeft -= slabSize;
+
+    FreeList& shared = m_shared[sizeClass];
+    for (size_t offset = 0; offset < slabSize; offset += blockSize)
+    {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + offset);
+        block->next = shared.head;
+        shared.head = block;
+        ++shared.count;
+    }
+}
@@ -0,0 +1,85 @@
+/**************************************************************
+* @file SlabAllocator.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include <atomic>
+#include <mutex>
+
+#include "UserAllocator.h"
+
+/**
+* @class SlabAllocator
+* @brief Default UserAllocator: blocks of up to 32 KB are served from per-size-class freelists cached by every
+*        thread, larger blocks from malloc.
+* @note Size classes are powers of two from 16 bytes. A thread takes and gives back blocks of a size class to a
+*       shared freelist in batches, which is refilled by carving slabs out of regions of 2 MB mapped from the
+*       system. Regions are advised for transparent huge pages and, with a NUMA node hint, bound to that node.
+*       The memory of the regions is reused but never returned to the system.
+*/
+
+class SlabAllocator : public UserAllocator
+{
+public:
+    SlabAllocator();
+
+    ~SlabAllocator();
+
+    void* allocate(size_t size, int32_t numaNode) override;
+
+    void deallocate(void* ptr, size_t size) override;
+
+    const char* get_name() const override
+    {
+        return "slab";
+    }
+
+    // Get the number of bytes mapped for slabs
+    uint64_t get_reserved_bytes() const
+    {
+        return m_reservedBytes.load(std::memory_order_relaxed);
+    }
+
+    // Number of size classes, from 16 bytes to 32 KB
+    static const uint32_t CLASS_COUNT = 12;
+
+    // Number of blocks moved at once between a thread and the shared freelist
+    static const uint32_t BATCH_SIZE = 32;
+
+    // Block of the freelists, linked through its first bytes while it is free
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    // Freelist of one size class
+    struct FreeList
+    {
+        FreeBlock* head;
+        uint32_t count;
+    };
+
+    // Take up to BATCH_SIZE blocks of a size class from the shared freelist into list
+    void refill(uint32_t sizeClass, FreeList& list, int32_t numaNode);
+
+    // Give BATCH_SIZE blocks of a size class back from list to the shared freelist
+    void release(uint32_t sizeClass, FreeList& list);
+
+private:
+    // Carve a new slab of a size class out of the current region, with the mutex of the size class held
+    void carve_slab(uint32_t sizeClass, int32_t numaNode);
+
+    // Shared freelists, each with its own mutex so that threads exchanging different sizes do not contend
+    std::mutex m_sharedMutex[CLASS_COUNT];
+    FreeList m_shared[CLASS_COUNT];
+    std::mutex m_regionMutex;
+    char* m_region;
+    size_t m_regionLeft;
+    std::atomic<uint64_t> m_reservedBytes;
+};
+
+#endif // SLAB_ALLOCATOR_H
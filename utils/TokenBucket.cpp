@@ -0,0 +1,100 @@
+/**************************************************************
+* @file TokenBucket.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "TokenBucket.h"
+
+#include <algorithm>
+#include <thread>
+
+TokenBucket::TokenBucket(uint64_t rate, uint64_t burst, TokenBucket* lender)
+    : m_rate(std::max<uint64_t>(rate, 1)),
+      m_burst(std::max<uint64_t>(burst, 1)),
+      m_lender(lender),
+      m_tokens(static_cast<double>(m_burst)),
+      m_borrowed(0),
+      m_last(std::chrono::steady_clock::now())
+{
+}
+
+void TokenBucket::acquire(uint64_t bytes)
+{
+    // A sample larger than the burst waits for a full bucket only
+    double needed = static_cast<double>(std::min(bytes, m_burst));
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        auto now = std::chrono::steady_clock::now();
+        refill(now);
+        if ((m_tokens < needed) && (m_lender != nullptr))
+        {
+            // Borrow without holding the lock, so that buckets never wait for each other's
+            uint64_t lacking = static_cast<uint64_t>(needed - m_tokens) + 1;
+            lock.unlock();
+            uint64_t lent = m_lender->lend(lacking);
+            lock.lock();
+            refill(std::chrono::steady_clock::now());
+            m_tokens += static_cast<double>(lent);
+            m_borrowed += lent;
+        }
+        if (m_tokens >= needed)
+        {
+            m_tokens -= static_cast<double>(bytes);
+            return;
+        }
+
+        // Sleep for most of the time left and spin the rest, sleeping is not accurate below a few tens of us
+        auto missing = std::chrono::nanoseconds(static_cast<int64_t>((needed - m_tokens) * 1e9 / static_cast<double>(m_rate)));
+        lock.unlock();
+        if (missing > std::chrono::microseconds(100))
+        {
+            std::this_thread::sleep_for(missing - std::chrono::microseconds(50));
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+        lock.lock();
+    }
+}
+
+bool TokenBucket::try_acquire(uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refill(std::chrono::steady_clock::now());
+    if (m_tokens < static_cast<double>(bytes))
+    {
+        return false;
+    }
+    m_tokens -= static_cast<double>(bytes);
+    return true;
+}
+
+int64_t TokenBucket::get_fill_level()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refill(std::chrono::steady_clock::now());
+    return static_cast<int64_t>(m_tokens);
+}
+
+void TokenBucket::refill(const std::chrono::steady_clock::time_point& now)
+{
+    double elapsed = std::chrono::duration<double>(now - m_last).count();
+    m_last = now;
+    m_tokens = std::min(m_tokens + elapsed * static_cast<double>(m_rate), static_cast<double>(m_burst));
+}
+
+uint64_t TokenBucket::lend(uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refill(std::chrono::steady_clock::now());
+    if (m_tokens <= 0)
+    {
+        return 0;
+    }
+    uint64_t lent = std::min(bytes, static_cast<uint64_t>(m_tokens));
+    m_tokens -= static_cast<double>(lent);
+    return lent;
+}
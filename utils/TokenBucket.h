@@ -0,0 +1,73 @@
+/**************************************************************
+* @file TokenBucket.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef TOKEN_BUCKET_H
+#define TOKEN_BUCKET_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+/**
+* @class TokenBucket
+* @brief This class paces the samples written by an application to a rate in bytes per second, letting up to
+*        burst bytes go at once after an idle time instead of cutting the writes into fixed period windows.
+* @note Credit accrues continuously at the rate and is capped at the burst size. A sample waits until the credit
+*       covers it, and a sample larger than the burst waits for a full bucket and leaves the bucket in debt, so
+*       the average rate holds for samples of any size. A bucket may borrow the credit it lacks from a lender
+*       shared by several buckets, which then paces all of them together. The lender is called without the lock
+*       of the borrowing bucket held, and must not borrow from it in turn.
+*/
+
+class TokenBucket
+{
+public:
+    TokenBucket(uint64_t rate, uint64_t burst, TokenBucket* lender = nullptr);
+
+    // Wait until the credit covers bytes, or the bucket is full, then consume bytes of it
+    void acquire(uint64_t bytes);
+
+    // Consume bytes of credit if that much is available, without waiting
+    bool try_acquire(uint64_t bytes);
+
+    // Get the credit available in bytes, negative when the bucket is in debt
+    int64_t get_fill_level();
+
+    // Get the number of bytes of credit borrowed from the lender
+    uint64_t get_borrowed_bytes() const
+    {
+        return m_borrowed;
+    }
+
+    uint64_t get_rate() const
+    {
+        return m_rate;
+    }
+
+    uint64_t get_burst() const
+    {
+        return m_burst;
+    }
+
+private:
+    // Add the credit accrued since the last refill, with m_mutex held
+    void refill(const std::chrono::steady_clock::time_point& now);
+
+    // Take up to bytes of spare credit from the bucket, return the number of bytes taken
+    uint64_t lend(uint64_t bytes);
+
+    std::mutex m_mutex;
+    uint64_t m_rate;
+    uint64_t m_burst;
+    TokenBucket* m_lender;
+    double m_tokens;
+    // Read without the lock by get_borrowed_bytes()
+    std::atomic<uint64_t> m_borrowed;
+    std::chrono::steady_clock::time_point m_last;
+};
+
+#endif // TOKEN_BUCKET_H
@@ -0,0 +1,168 @@
+/**************************************************************
+* @file UserAllocator.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "UserAllocator.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+namespace {
+    // Header in front of every block, telling which allocator it comes from and its size
+    struct BlockHeader
+    {
+        uint64_t size;
+        uint64_t tag;
+    };
+
+    const uint64_t MALLOC_BLOCK_TAG = 0x4753444d414c4c43;
+    const uint64_t USER_BLOCK_TAG = 0x4753445553455221;
+
+    std::atomic<UserAllocator*> g_allocator {nullptr};
+    std::atomic<int32_t> g_numaNode {-1};
+}
+
+bool UserAllocator::install(UserAllocator* allocator, int32_t numaNode)
+{
+#ifdef USE_USER_ALLOCATOR
+    UserAllocator* expected = nullptr;
+    g_numaNode.store(numaNode, std::memory_order_relaxed);
+    if (!g_allocator.compare_exchange_strong(expected, allocator, std::memory_order_acq_rel))
+    {
+        std::cout << "An allocator is already installed: " << expected->get_name() << std::endl;
+        return false;
+    }
+    return true;
+#else
+    (void)allocator;
+    (void)numaNode;
+    std::cout << "Built without USE_USER_ALLOCATOR, allocations stay with malloc" << std::endl;
+    return false;
+#endif
+}
+
+UserAllocator* UserAllocator::get_installed()
+{
+    return g_allocator.load(std::memory_order_acquire);
+}
+
+#ifdef USE_USER_ALLOCATOR
+
+namespace {
+    void* allocate_block(std::size_t size)
+    {
+        std::size_t blockSize = size + sizeof(BlockHeader);
+        UserAllocator* allocator = g_allocator.load(std::memory_order_acquire);
+        BlockHeader* header;
+        if (allocator != nullptr)
+        {
+            header = static_cast<BlockHeader*>(
+                allocator->allocate(blockSize, g_numaNode.load(std::memory_order_relaxed)));
+            if (header == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            header->tag = USER_BLOCK_TAG;
+        }
+        else
+        {
+            header = static_cast<BlockHeader*>(std::malloc(blockSize));
+            if (header == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            header->tag = MALLOC_BLOCK_TAG;
+        }
+        header->size = blockSize;
+        return header + 1;
+    }
+
+    void deallocate_block(void* ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+        if (header->tag == USER_BLOCK_TAG)
+        {
+            g_allocator.load(std::memory_order_acquire)->deallocate(header, header->size);
+        }
+        else
+        {
+            std::free(header);
+        }
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate_block(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate_block(size);
+}
+
+// The nothrow forms are replaced as well, libstdc++ before GCC 9 implements them with malloc, which would
+// leave the block without a header for the delete below
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate_block(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate_block(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    deallocate_block(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    deallocate_block(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    deallocate_block(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    deallocate_block(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    deallocate_block(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    deallocate_block(ptr);
+}
+
+#endif // USE_USER_ALLOCATOR
@@ -0,0 +1,47 @@
+/**************************************************************
+* @file UserAllocator.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef USER_ALLOCATOR_H
+#define USER_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+* @class UserAllocator
+* @brief Interface of an allocator serving the heap allocations of the whole process, including the payloads,
+*        history caches, discovery data and DynamicData trees allocated inside the DDS library.
+* @note The DDS library allocates with the global operator new, so an allocator is plugged in by replacing it.
+*       The replacement is only built when USE_USER_ALLOCATOR is defined, see the CMakeLists.txt of the
+*       Throughput demo. Install the allocator once, before the first participant is created; blocks allocated
+*       before are still released with free(). The allocator must outlive every block it has allocated, so it
+*       is never uninstalled. Allocations made by the library with malloc directly are not routed.
+*/
+
+class UserAllocator
+{
+public:
+    virtual ~UserAllocator()
+    {
+    }
+
+    // Allocate a block of size bytes aligned on 16 bytes, preferably on numaNode unless it is negative
+    virtual void* allocate(size_t size, int32_t numaNode) = 0;
+
+    // Release a block of size bytes allocated by allocate()
+    virtual void deallocate(void* ptr, size_t size) = 0;
+
+    // Get the name of the allocator
+    virtual const char* get_name() const = 0;
+
+    // Route the allocations of the process to allocator from now on, with numaNode as hint
+    static bool install(UserAllocator* allocator, int32_t numaNode = -1);
+
+    // Get the allocator installed, nullptr if allocations go to malloc
+    static UserAllocator* get_installed();
+};
+
+#endif // USER_ALLOCATOR_H
@@ -0,0 +1,83 @@
+/**************************************************************
+* @file WriterAckProbe.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include "WriterAckProbe.h"
+
+#include <algorithm>
+#include <cmath>
+
+WriterAckProbe::WriterAckProbe(greenstone::dds::DataWriter* writer)
+    : m_writer(writer)
+{
+    reset();
+}
+
+bool WriterAckProbe::probe(const greenstone::dds::Duration_t& maxWait)
+{
+    auto start = std::chrono::steady_clock::now();
+    bool acked = (m_writer->wait_for_acknowledgements(maxWait) == greenstone::dds::ReturnCode_t::RETCODE_OK);
+    auto end = std::chrono::steady_clock::now();
+    ++m_probes;
+    m_maxOutstanding = std::max(m_maxOutstanding, m_outstanding);
+    if (!acked)
+    {
+        // The wait says nothing about the time the samples take, keep them outstanding for the next probe
+        ++m_timeouts;
+        return false;
+    }
+
+    double sample = std::chrono::duration<double, std::micro>(end - start).count();
+    if (m_min < 0)
+    {
+        m_smoothed = sample;
+        m_variation = sample / 2;
+        m_min = sample;
+        m_max = sample;
+    }
+    else
+    {
+        // Same gains as the round trip time estimation of TCP, RFC 6298
+        m_variation = 0.75 * m_variation + 0.25 * std::fabs(m_smoothed - sample);
+        m_smoothed = 0.875 * m_smoothed + 0.125 * sample;
+        m_min = std::min(m_min, sample);
+        m_max = std::max(m_max, sample);
+    }
+    m_acked += m_outstanding;
+    m_outstanding = 0;
+    m_lastAcked = end;
+    return true;
+}
+
+double WriterAckProbe::get_delivered_rate() const
+{
+    double elapsed = std::chrono::duration<double>(m_lastAcked - m_first).count();
+    return (elapsed > 0) ? static_cast<double>(m_acked) / elapsed : 0;
+}
+
+int32_t WriterAckProbe::get_writer_timeout_count() const
+{
+    greenstone::dds::WriterLostPacketStatisticInfo info;
+    if (m_writer->get_lost_packet_statistic(info) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+    {
+        return 0;
+    }
+    return info.w_timeout_count();
+}
+
+void WriterAckProbe::reset()
+{
+    m_first = std::chrono::steady_clock::now();
+    m_lastAcked = m_first;
+    m_outstanding = 0;
+    m_maxOutstanding = 0;
+    m_acked = 0;
+    m_smoothed = 0;
+    m_variation = 0;
+    m_min = -1;
+    m_max = 0;
+    m_probes = 0;
+    m_timeouts = 0;
+}
@@ -0,0 +1,112 @@
+/**************************************************************
+* @file WriterAckProbe.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef WRITER_ACK_PROBE_H
+#define WRITER_ACK_PROBE_H
+
+#include <chrono>
+#include <cstdint>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class WriterAckProbe
+* @brief This class estimates the acknowledgement time, the delivered throughput and the outstanding window of
+*        a reliable DataWriter as a whole, by timing waits for the acknowledgement of all its readers.
+* @note The estimates are not per reader: the writer does not expose the heartbeat and ACKNACK exchange of
+*       each reader, so probe() times wait_for_acknowledgements, whose result is set by the slowest reliable
+*       matched reader, whichever it is. The acknowledgement time of a probe made right after a write approaches
+*       the round trip time to that reader, and grows with the samples it has not acknowledged yet when it
+*       falls behind. The time is smoothed like the round trip time of TCP. A probe that times out while the
+*       previous ones were short tells that some reader stopped acknowledging, which stalls a KEEP_ALL writer
+*       for max_blocking_time on every write once the history is full, but not which one. Probing blocks the
+*       writing thread, so it should be done every few hundred samples at most.
+*/
+
+class WriterAckProbe
+{
+public:
+    explicit WriterAckProbe(greenstone::dds::DataWriter* writer);
+
+    // Count a sample of bytes written since the last probe
+    void on_written(uint64_t bytes)
+    {
+        m_outstanding += bytes;
+    }
+
+    // Wait until the samples written are acknowledged by all reliable matched readers, return false on timeout
+    bool probe(const greenstone::dds::Duration_t& maxWait);
+
+    // Get the smoothed acknowledgement time (microsecond)
+    double get_ack_time() const
+    {
+        return m_smoothed;
+    }
+
+    // Get the variation of the acknowledgement time (microsecond)
+    double get_ack_time_variation() const
+    {
+        return m_variation;
+    }
+
+    // Get the lowest and highest acknowledgement time of the probes (microsecond)
+    double get_min_ack_time() const
+    {
+        return (m_min < 0) ? 0 : m_min;
+    }
+
+    double get_max_ack_time() const
+    {
+        return m_max;
+    }
+
+    // Get the bytes acknowledged per second since the probe was created or reset
+    double get_delivered_rate() const;
+
+    // Get the bytes written since the last probe all readers acknowledged
+    uint64_t get_outstanding_bytes() const
+    {
+        return m_outstanding;
+    }
+
+    // Get the largest number of bytes a probe had to wait for
+    uint64_t get_max_outstanding_bytes() const
+    {
+        return m_maxOutstanding;
+    }
+
+    // Get the number of probes made and of probes timed out
+    uint32_t get_number_of_probes() const
+    {
+        return m_probes;
+    }
+
+    uint32_t get_number_of_timeouts() const
+    {
+        return m_timeouts;
+    }
+
+    // Get the number of samples the writer dropped because a reader did not acknowledge them in time
+    int32_t get_writer_timeout_count() const;
+
+    // Reset the estimates
+    void reset();
+
+private:
+    greenstone::dds::DataWriter* m_writer;
+    std::chrono::steady_clock::time_point m_first;
+    std::chrono::steady_clock::time_point m_lastAcked;
+    uint64_t m_outstanding;
+    uint64_t m_maxOutstanding;
+    uint64_t m_acked;
+    double m_smoothed;
+    double m_variation;
+    double m_min;
+    double m_max;
+    uint32_t m_probes;
+    uint32_t m_timeouts;
+};
+
+#endif // WRITER_ACK_PROBE_H
@@ -0,0 +1,70 @@
+/**************************************************************
+* @file WriterDecimator.cpp
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include "WriterDecimator.h"
+
+void WriterDecimator::update_matched_readers(greenstone::dds::DataWriter* writer)
+{
+    greenstone::dds::HandleSeq handles;
+    if ((writer == nullptr) ||
+        (writer->get_matched_subscriptions(handles) != greenstone::dds::ReturnCode_t::RETCODE_OK) ||
+        handles.empty())
+    {
+        m_separation = 0;
+        return;
+    }
+
+    int64_t separation = INT64_MAX;
+    for (const greenstone::dds::InstanceHandle_t& handle : handles)
+    {
+        greenstone::dds::SubscriptionBuiltinTopicData data;
+        if (writer->get_matched_subscription_data(data, handle) != greenstone::dds::ReturnCode_t::RETCODE_OK)
+        {
+            // The QoS of the reader is unknown, so every sample may be wanted
+            separation = 0;
+            break;
+        }
+
+        const greenstone::dds::Duration_t& minimumSeparation = data.time_based_filter().minimum_separation();
+        if (minimumSeparation.is_infinite())
+        {
+            continue;
+        }
+        int64_t readerSeparation = static_cast<int64_t>(minimumSeparation.seconds()) * 1000000000 + minimumSeparation.nanosec();
+        separation = (std::min)(separation, readerSeparation);
+    }
+
+    m_separation = (separation == INT64_MAX) ? 0 : separation;
+}
+
+bool WriterDecimator::is_due(const greenstone::dds::InstanceHandle_t& handle, const std::chrono::steady_clock::time_point& now)
+{
+    int64_t separation = m_separation;
+    if (separation <= 0)
+    {
+        ++m_passed;
+        return true;
+    }
+
+    auto it = m_lastWritten.find(handle);
+    if (it == m_lastWritten.end())
+    {
+        m_lastWritten.emplace(handle, now);
+        ++m_passed;
+        return true;
+    }
+    if (std::chrono::duration_cast<std::chrono::nanoseconds>(now - it->second).count() < separation + m_tolerance)
+    {
+        ++m_skipped;
+        return false;
+    }
+
+    it->second = now;
+    ++m_passed;
+    return true;
+}
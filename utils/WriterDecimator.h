@@ -0,0 +1,86 @@
+/**************************************************************
+* @file WriterDecimator.h
+* @copyright GREENSTONE TECHNOLOGY CO.,LTD. 2020-2023
+*  All rights reserved
+**************************************************************/
+
+#ifndef WRITER_DECIMATOR_H
+#define WRITER_DECIMATOR_H
+
+#include <map>
+#include <atomic>
+#include <chrono>
+#include "swiftdds/dcps/SwiftDdsExport.h"
+
+/**
+* @class WriterDecimator
+* @brief This class decimates the samples of a DataWriter per instance according to the time_based_filter
+*        of its matched readers, so samples every reader would drop are not sent at all.
+* @note A sample is due when the minimum_separation shared by all matched readers plus a tolerance has passed
+*       since the last sample written for the same instance. Readers filter on the reception time of the last
+*       sample they delivered, so the tolerance keeps samples written exactly one separation apart from being
+*       dropped when they arrive with jitter. A reader with a zero or unknown minimum_separation disables
+*       decimation. Readers keep their own time_based_filter, which still drops samples for readers with a
+*       larger minimum_separation than the shared one, or whose samples arrive with more jitter than the
+*       tolerance. update_matched_readers() can be called from a writer listener, is_due() and
+*       remove_instance() are meant to be called from the writing thread only.
+*/
+
+class WriterDecimator
+{
+public:
+    // The tolerance (nanosecond) is added to the minimum separation to absorb the jitter of the transport
+    explicit WriterDecimator(int64_t tolerance = 2000000) : m_tolerance(tolerance) {}
+
+    // Refresh the minimum separation from the time_based_filter of the readers matched with the writer
+    void update_matched_readers(greenstone::dds::DataWriter* writer);
+
+    // Check whether a sample of the instance is due at the given time, skip writing it if not
+    bool is_due(const greenstone::dds::InstanceHandle_t& handle, const std::chrono::steady_clock::time_point& now);
+
+    // Check whether a sample of the instance is due now
+    bool is_due(const greenstone::dds::InstanceHandle_t& handle)
+    {
+        return is_due(handle, std::chrono::steady_clock::now());
+    }
+
+    // Forget an instance once it is unregistered or disposed
+    void remove_instance(const greenstone::dds::InstanceHandle_t& handle)
+    {
+        m_lastWritten.erase(handle);
+    }
+
+    // Get the minimum separation shared by all matched readers (nanosecond)
+    int64_t get_separation() const
+    {
+        return m_separation;
+    }
+
+    // Get the number of samples that were due
+    uint64_t get_number_of_passed() const
+    {
+        return m_passed;
+    }
+
+    // Get the number of samples that were skipped
+    uint64_t get_number_of_skipped() const
+    {
+        return m_skipped;
+    }
+
+private:
+    // Added to the minimum separation (nanosecond)
+    int64_t m_tolerance;
+
+    // Minimum separation shared by all matched readers (nanosecond)
+    std::atomic<int64_t> m_separation {0};
+
+    // Time of the last sample written for each instance
+    std::map<greenstone::dds::InstanceHandle_t, std::chrono::steady_clock::time_point> m_lastWritten;
+
+    // Statistics of the samples checked
+    uint64_t m_passed {0};
+    uint64_t m_skipped {0};
+};
+
+#endif // WRITER_DECIMATOR_H